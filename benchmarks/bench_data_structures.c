@@ -0,0 +1,165 @@
+/**
+ * @file bench_data_structures.c
+ * @brief Microbenchmarks for the ready-queue containers.
+ *
+ * Compares the array-backed Queue and Stack against the linked-list versions
+ * they replaced (kept here as a baseline), on the access patterns the policies
+ * actually use. Build and run with `make bench`.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "../headers/data_structures/data_structures.h"
+
+#define PROCESS_COUNT 64
+#define OPERATIONS 20000000L
+
+// --- Baseline: the previous linked-list implementation (one malloc per insert) ---
+
+typedef struct ListNode {
+    Process* process;
+    struct ListNode* next;
+} ListNode;
+
+typedef struct {
+    ListNode* start;
+    ListNode* end;
+    int size;
+} ListQueue;
+
+static void list_enqueue(ListQueue* q, Process* p) {
+    ListNode* node = (ListNode*) malloc(sizeof(ListNode));
+    if (!node) return;
+    node->process = p;
+    node->next = NULL;
+    if (q->size == 0) q->start = node;
+    else q->end->next = node;
+    q->end = node;
+    q->size++;
+}
+
+static Process* list_dequeue(ListQueue* q) {
+    if (!q->start) return NULL;
+    ListNode* node = q->start;
+    q->start = node->next;
+    if (!q->start) q->end = NULL;
+    q->size--;
+    Process* p = node->process;
+    free(node);
+    return p;
+}
+
+static void list_push(ListNode** top, Process* p) {
+    ListNode* node = (ListNode*) malloc(sizeof(ListNode));
+    if (!node) return;
+    node->process = p;
+    node->next = *top;
+    *top = node;
+}
+
+static Process* list_pop(ListNode** top) {
+    if (!*top) return NULL;
+    ListNode* node = *top;
+    *top = node->next;
+    Process* p = node->process;
+    free(node);
+    return p;
+}
+
+// --- Timing helpers ---
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the optimizer from discarding the loops
+static volatile uintptr_t sink;
+
+static void report(const char* name, const char* impl, long operations, double seconds) {
+    printf("| %-32s | %-12s | %12.1f |\n", name, impl, operations / seconds / 1e6);
+}
+
+// --- Workloads ---
+
+// RR/MLFQ quantum expiry: the running process goes back to the tail of a busy queue
+static void bench_queue_rotation(Process* processes) {
+    ListQueue list = {0};
+    for (int i = 0; i < PROCESS_COUNT; i++) list_enqueue(&list, &processes[i]);
+    double start = now_seconds();
+    for (long i = 0; i < OPERATIONS / 2; i++) {
+        list_enqueue(&list, list_dequeue(&list));
+    }
+    report("queue rotate (dequeue+enqueue)", "linked list", OPERATIONS, now_seconds() - start);
+    while (list.size) sink += (uintptr_t)list_dequeue(&list);
+
+    Queue* q = queue_create();
+    for (int i = 0; i < PROCESS_COUNT; i++) queue_enqueue(q, &processes[i]);
+    start = now_seconds();
+    for (long i = 0; i < OPERATIONS / 2; i++) {
+        queue_enqueue(q, queue_dequeue(q));
+    }
+    report("queue rotate (dequeue+enqueue)", "ring buffer", OPERATIONS, now_seconds() - start);
+    sink += (uintptr_t)queue_peek(q);
+    queue_destroy(q);
+}
+
+// Arrival bursts: fill the queue, then drain it completely
+static void bench_queue_fill_drain(Process* processes) {
+    long rounds = OPERATIONS / (2 * PROCESS_COUNT);
+
+    ListQueue list = {0};
+    double start = now_seconds();
+    for (long r = 0; r < rounds; r++) {
+        for (int i = 0; i < PROCESS_COUNT; i++) list_enqueue(&list, &processes[i]);
+        while (list.size) sink += (uintptr_t)list_dequeue(&list);
+    }
+    report("queue fill + drain", "linked list", rounds * 2 * PROCESS_COUNT, now_seconds() - start);
+
+    Queue* q = queue_create();
+    start = now_seconds();
+    for (long r = 0; r < rounds; r++) {
+        for (int i = 0; i < PROCESS_COUNT; i++) queue_enqueue(q, &processes[i]);
+        while (!queue_is_empty(q)) sink += (uintptr_t)queue_dequeue(q);
+    }
+    report("queue fill + drain", "ring buffer", rounds * 2 * PROCESS_COUNT, now_seconds() - start);
+    queue_destroy(q);
+}
+
+// LIFO: push a burst of arrivals, pop them all
+static void bench_stack_push_pop(Process* processes) {
+    long rounds = OPERATIONS / (2 * PROCESS_COUNT);
+
+    ListNode* top = NULL;
+    double start = now_seconds();
+    for (long r = 0; r < rounds; r++) {
+        for (int i = 0; i < PROCESS_COUNT; i++) list_push(&top, &processes[i]);
+        while (top) sink += (uintptr_t)list_pop(&top);
+    }
+    report("stack push + pop", "linked list", rounds * 2 * PROCESS_COUNT, now_seconds() - start);
+
+    Stack* s = stack_create();
+    start = now_seconds();
+    for (long r = 0; r < rounds; r++) {
+        for (int i = 0; i < PROCESS_COUNT; i++) stack_push(s, &processes[i]);
+        while (!stack_is_empty(s)) sink += (uintptr_t)stack_pop(s);
+    }
+    report("stack push + pop", "array", rounds * 2 * PROCESS_COUNT, now_seconds() - start);
+    stack_destroy(s);
+}
+
+int main() {
+    Process processes[PROCESS_COUNT];
+
+    printf("Ready-queue container microbenchmarks (%d processes, %ld operations)\n\n", PROCESS_COUNT, OPERATIONS);
+    printf("| %-32s | %-12s | %12s |\n", "Workload", "Container", "Mops/sec");
+    printf("|----------------------------------|--------------|--------------|\n");
+    bench_queue_rotation(processes);
+    bench_queue_fill_drain(processes);
+    bench_stack_push_pop(processes);
+    return 0;
+}
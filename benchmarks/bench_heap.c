@@ -0,0 +1,178 @@
+/**
+ * @file bench_heap.c
+ * @brief Ready-queue heap microbenchmarks on 10^6-entry queues.
+ *
+ * Measures pop + push "decisions" per second for the 4-ary heap (built-in key
+ * and custom comparator) against the recursive binary heap with a comparator
+ * call per level that it replaced (kept here as a baseline), then the decision
+ * throughput of each heap-backed policy through the policy interface.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../headers/data_structures/data_structures.h"
+#include "../headers/engine/policy_interface.h"
+
+#define QUEUE_SIZE 1000000
+#define DECISIONS 2000000
+
+// --- Baseline: the previous binary heap (recursive sifts, comparator pointer) ---
+
+typedef struct {
+    Process** data;
+    int size;
+    Comparator comp;
+} BinaryHeap;
+
+static void binary_swap(Process** a, Process** b) {
+    Process* temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void binary_heapify_up(BinaryHeap* h, int index) {
+    if (index == 0) return;
+    int parent_index = (index - 1) / 2;
+    if (h->comp(h->data[index], h->data[parent_index]) < 0) {
+        binary_swap(&h->data[index], &h->data[parent_index]);
+        binary_heapify_up(h, parent_index);
+    }
+}
+
+static void binary_heapify_down(BinaryHeap* h, int index) {
+    int smallest = index;
+    int left_child = 2 * index + 1;
+    int right_child = 2 * index + 2;
+    if (left_child < h->size && h->comp(h->data[left_child], h->data[smallest]) < 0) smallest = left_child;
+    if (right_child < h->size && h->comp(h->data[right_child], h->data[smallest]) < 0) smallest = right_child;
+    if (smallest != index) {
+        binary_swap(&h->data[index], &h->data[smallest]);
+        binary_heapify_down(h, smallest);
+    }
+}
+
+static void binary_push(BinaryHeap* h, Process* p) {
+    h->data[h->size] = p;
+    binary_heapify_up(h, h->size);
+    h->size++;
+}
+
+static Process* binary_pop(BinaryHeap* h) {
+    Process* root = h->data[0];
+    h->data[0] = h->data[--h->size];
+    if (h->size > 0) binary_heapify_down(h, 0);
+    return root;
+}
+
+static int burst_comparator(Process* a, Process* b) {
+    if (a->burst_time != b->burst_time) return a->burst_time - b->burst_time;
+    if (a->arrival_time != b->arrival_time) return a->arrival_time - b->arrival_time;
+    return a->original_index - b->original_index;
+}
+
+// --- Helpers ---
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static Process* make_processes(void) {
+    Process* processes = (Process*)calloc(QUEUE_SIZE, sizeof(Process));
+    if (!processes) return NULL;
+    srand(42);
+    for (int i = 0; i < QUEUE_SIZE; i++) {
+        processes[i].original_index = i;
+        processes[i].arrival_time = rand() % 100000;
+        processes[i].burst_time = 1 + rand() % 1000;
+        processes[i].remaining_burst_time = processes[i].burst_time;
+        processes[i].priority = rand() % 10;
+        processes[i].last_executed_time = -1;
+    }
+    return processes;
+}
+
+// A decision takes the first process and puts it back with a new key, as a preemption would
+static void requeue(Process* p, long decision) {
+    p->burst_time = 1 + (int)((p->burst_time * 7919L + decision) % 1000);
+    p->remaining_burst_time = p->burst_time;
+    p->last_executed_time = (int)decision;
+}
+
+static void report(const char* name, double seconds) {
+    printf("| %-40s | %14.2f |\n", name, DECISIONS / seconds / 1e6);
+}
+
+// --- Benchmarks ---
+
+static void bench_binary_heap(Process* processes) {
+    BinaryHeap h = { (Process**)malloc(QUEUE_SIZE * sizeof(Process*)), 0, burst_comparator };
+    for (int i = 0; i < QUEUE_SIZE; i++) binary_push(&h, &processes[i]);
+    double start = now_seconds();
+    for (long d = 0; d < DECISIONS; d++) {
+        Process* p = binary_pop(&h);
+        requeue(p, d);
+        binary_push(&h, p);
+    }
+    report("binary heap, comparator call (old)", now_seconds() - start);
+    free(h.data);
+}
+
+static void bench_heap(Process* processes, Heap* h, const char* name) {
+    for (int i = 0; i < QUEUE_SIZE; i++) heap_push(h, &processes[i]);
+    double start = now_seconds();
+    for (long d = 0; d < DECISIONS; d++) {
+        Process* p = heap_pop(h);
+        requeue(p, d);
+        heap_push(h, p);
+    }
+    report(name, now_seconds() - start);
+    heap_destroy(h);
+}
+
+static void bench_policy(Process* processes, const char* policy_name) {
+    Policy* policy = policy_create(policy_name, 0);
+    if (!policy) return;
+    for (int i = 0; i < QUEUE_SIZE; i++) policy_add_process(policy, &processes[i]);
+    double start = now_seconds();
+    for (long d = 0; d < DECISIONS; d++) {
+        Process* p = policy_get_next_process(policy);
+        requeue(p, d);
+        policy_add_process(policy, p);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "policy %s", policy_name);
+    report(name, now_seconds() - start);
+    policy_destroy(policy);
+}
+
+int main() {
+    Process* processes = make_processes();
+    if (!processes) return 1;
+
+    printf("Heap decision throughput (%d queued processes, %d pop+push decisions)\n\n", QUEUE_SIZE, DECISIONS);
+    printf("| %-40s | %14s |\n", "Ready queue", "Mdecisions/sec");
+    printf("|------------------------------------------|----------------|\n");
+    bench_binary_heap(processes);
+
+    free(processes);
+    processes = make_processes();
+    bench_heap(processes, heap_create(burst_comparator), "4-ary heap, comparator call");
+
+    free(processes);
+    processes = make_processes();
+    bench_heap(processes, heap_create_keyed(HEAP_KEY_BURST), "4-ary heap, inline burst key");
+
+    const char* policies[] = {"sjf", "srt", "priority", "preemptive_priority"};
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+        free(processes);
+        processes = make_processes();
+        bench_policy(processes, policies[i]);
+    }
+
+    free(processes);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file bench_mlfq.c
+ * @brief MLFQ aging cost as the ready queues grow.
+ *
+ * N processes wait in the non-top levels. The first AGING_THRESHOLD ticks
+ * promote nobody ("quiet" ticks); the next tick promotes all of them. With
+ * lazy aging a quiet tick should cost the same for any N, and the aging tick
+ * should cost a constant amount per promoted process.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../headers/engine/policy_interface.h"
+
+#define AGING_THRESHOLD 10      // Must match src/policies/mlfq.c
+#define TOTAL_WAITERS 4000000L  // Waiters simulated per queue size (spread over repetitions)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench_queue_size(int process_count) {
+    Process* processes = (Process*)calloc(process_count, sizeof(Process));
+    if (!processes) return;
+
+    long repetitions = TOTAL_WAITERS / process_count;
+    double quiet_seconds = 0.0, aging_seconds = 0.0;
+    srand(11);
+    for (long r = 0; r < repetitions; r++) {
+        Policy* policy = policy_create("mlfq", 2);
+        if (!policy) break;
+        for (int i = 0; i < process_count; i++) {
+            processes[i].original_index = i;
+            processes[i].priority = rand() % 19;    // Every level but the top one ages
+            policy_add_process(policy, &processes[i]);
+        }
+
+        double start = now_seconds();
+        for (int t = 0; t < AGING_THRESHOLD; t++) policy_tick(policy);
+        double middle = now_seconds();
+        policy_tick(policy);
+        double end = now_seconds();
+
+        quiet_seconds += middle - start;
+        aging_seconds += end - middle;
+        policy_destroy(policy);
+    }
+
+    printf("| %10d | %16.1f | %20.1f |\n", process_count,
+           quiet_seconds / (repetitions * AGING_THRESHOLD) * 1e9,
+           aging_seconds / ((double)repetitions * process_count) * 1e9);
+    free(processes);
+}
+
+int main() {
+    printf("MLFQ aging cost (processes waiting below the top level)\n\n");
+    printf("| %10s | %16s | %20s |\n", "Waiting", "Quiet tick (ns)", "Aging tick (ns/proc)");
+    printf("|------------|------------------|----------------------|\n");
+    int sizes[] = {100, 1000, 10000, 100000};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        bench_queue_size(sizes[i]);
+    }
+    return 0;
+}
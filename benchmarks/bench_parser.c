@@ -0,0 +1,164 @@
+/**
+ * @file bench_parser.c
+ * @brief Config parser throughput on a generated multi-million-process file.
+ *
+ * Writes a temporary config in the format of configs/ (comments included),
+ * then parses it with the line-by-line reader and with the memory-mapped
+ * path, reporting MB/s for each. The in-memory parser is then timed on 1 to
+ * 8 threads, and the same processes are loaded back from a binary workload.
+ * Every path must return the same processes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../headers/parser/config_parser.h"
+#include "../headers/parser/workload_binary.h"
+
+#define PROCESS_COUNT 2000000
+#define REPETITIONS 3
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long write_config(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) return -1;
+    fprintf(file, "# Generated by bench_parser\n\"\"\"\nLarge synthetic workload\n\"\"\"\n\n");
+    srand(17);
+    for (int i = 0; i < PROCESS_COUNT; i++) {
+        fprintf(file, "process P%d {\n", i);
+        fprintf(file, "    arrival_time = %d\n", i / 4);
+        fprintf(file, "    burst_time   = %d   # CPU burst\n", 1 + rand() % 50);
+        if (i % 3) fprintf(file, "    priority     = %d\n", rand() % 20);
+        fprintf(file, "}\n\n");
+    }
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+static void report(const char* label, double seconds, long size) {
+    double megabytes = size / (1024.0 * 1024.0);
+    printf("| %-20s | %10.1f | %10.1f |\n", label, seconds * 1000.0, megabytes / seconds);
+}
+
+int main() {
+    char path[] = "/tmp/bench_parser_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("bench_parser: mkstemp");
+        return 1;
+    }
+    close(fd);
+
+    long size = write_config(path);
+    if (size < 0) {
+        perror("bench_parser: write config");
+        unlink(path);
+        return 1;
+    }
+
+    printf("Config parser throughput (%d processes, %.1f MB, best of %d)\n\n", PROCESS_COUNT, size / (1024.0 * 1024.0), REPETITIONS);
+    printf("| %-20s | %10s | %10s |\n", "Path", "Time (ms)", "MB/s");
+    printf("|----------------------|------------|------------|\n");
+
+    double best_stream = 1e30, best_mapped = 1e30;
+    int stream_count = 0, mapped_count = 0;
+    Process* stream_processes = NULL;
+    Process* mapped_processes = NULL;
+    for (int r = 0; r < REPETITIONS; r++) {
+        free(stream_processes);
+        free(mapped_processes);
+
+        double start = now_seconds();
+        FILE* file = fopen(path, "r");
+        stream_processes = file ? parse_config_stream(file, &stream_count) : NULL;
+        if (file) fclose(file);
+        double stream_seconds = now_seconds() - start;
+
+        ParseStats stats;
+        mapped_processes = parse_config_file_with_stats(path, &mapped_count, &stats);
+
+        if (stream_seconds < best_stream) best_stream = stream_seconds;
+        if (stats.seconds < best_mapped) best_mapped = stats.seconds;
+    }
+    report("fgets, line by line", best_stream, size);
+    report("mmap, in place", best_mapped, size);
+
+    // Thread scaling on text already in memory (no I/O, no page-cache faults)
+    char* text = (char*)malloc(size);
+    FILE* file = fopen(path, "r");
+    bool loaded = text && file && fread(text, 1, size, file) == (size_t)size;
+    if (file) fclose(file);
+    int thread_counts[] = {1, 2, 4, 8};
+    bool threads_agree = loaded;
+    for (size_t t = 0; loaded && t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        double best = 1e30;
+        for (int r = 0; r < REPETITIONS; r++) {
+            int count = 0;
+            double start = now_seconds();
+            Process* processes = parse_config_buffer_parallel(text, size, &count, thread_counts[t]);
+            double seconds = now_seconds() - start;
+            if (seconds < best) best = seconds;
+            if (!processes || count != mapped_count || memcmp(processes, mapped_processes, sizeof(Process) * count) != 0) threads_agree = false;
+            free(processes);
+        }
+        char label[32];
+        snprintf(label, sizeof(label), "in memory, %d thread%s", thread_counts[t], thread_counts[t] > 1 ? "s" : "");
+        report(label, best, size);
+    }
+    free(text);
+
+    // Binary workload with the same processes
+    char binary_path[] = "/tmp/bench_parser_binary_XXXXXX";
+    int binary_fd = mkstemp(binary_path);
+    bool binary_agrees = false;
+    if (binary_fd >= 0 && mapped_processes) {
+        close(binary_fd);
+        if (write_binary_workload(binary_path, mapped_processes, mapped_count) == 0) {
+            double best = 1e30;
+            long binary_size = 0;
+            binary_agrees = true;
+            for (int r = 0; r < REPETITIONS; r++) {
+                int count = 0;
+                ParseStats stats;
+                Process* processes = parse_config_file_with_stats(binary_path, &count, &stats);
+                if (stats.seconds < best) best = stats.seconds;
+                binary_size = (long)stats.bytes;
+                if (!processes || !stats.binary || count != mapped_count || memcmp(processes, mapped_processes, sizeof(Process) * count) != 0) binary_agrees = false;
+                free(processes);
+            }
+            report("binary workload", best, size);
+            printf("\n(binary file: %.1f MB; MB/s above is in text-config bytes)\n", binary_size / (1024.0 * 1024.0));
+        }
+        unlink(binary_path);
+    }
+
+    int status = 0;
+    if (!binary_agrees) {
+        fprintf(stderr, "bench_parser: the binary workload disagrees\n");
+        status = 1;
+    }
+    if (!threads_agree) {
+        fprintf(stderr, "bench_parser: the threaded parses disagree\n");
+        status = 1;
+    }
+    if (!stream_processes || !mapped_processes || stream_count != mapped_count ||
+        memcmp(stream_processes, mapped_processes, sizeof(Process) * stream_count) != 0) {
+        fprintf(stderr, "bench_parser: the two paths disagree\n");
+        status = 1;
+    }
+
+    free(stream_processes);
+    free(mapped_processes);
+    unlink(path);
+    return status;
+}
@@ -10,12 +10,37 @@
 
 #include <stdbool.h>
 
+#include "../engine/policy_interface.h"
+#include "../output/logger.h"
+
 /**
  * @brief Structure to hold parsed command-line arguments.
  */
 typedef struct {
     char* config_filepath;  // Path to configuration file
     bool verbose;           // Verbose mode flag
+    bool tick_engine;       // Use the tick-by-tick reference engine
+    int cpu_count;          // Number of simulated CPUs
+    bool per_cpu_queues;    // One run queue per CPU instead of a shared one
+    int balance_interval;   // Ticks between work-stealing opportunities (0: never steal)
+    int migration_cost;     // Ticks a CPU stalls before running a stolen process
+    bool sweep;             // Non-interactive sweep mode (set by --policies)
+    char* sweep_configs;    // Comma-separated extra config files to sweep over
+    char* sweep_policies;   // Comma-separated policy names, or "all"
+    char* sweep_quanta;     // Comma-separated quanta for quantum-based policies
+    int jobs;               // Sweep worker threads, or metric reduction threads of a single run (0: one per online CPU)
+    bool mlfq_custom;       // Set when any --mlfq-* option was given
+    MlfqParameters mlfq;    // MLFQ tuning (tables allocated by parse_arguments, see free_cli_params)
+    char* convert_output;   // Convert the config to this file instead of simulating (NULL: no conversion)
+    bool stream;            // Read processes as they arrive instead of loading the whole config
+    char* results_output;   // Write finished processes and Gantt segments to this file as they complete (NULL: keep them)
+    char* telemetry_output; // Write the queue/CPU time series to this CSV file (NULL: no telemetry)
+    int telemetry_stride;   // Ticks between two telemetry samples
+    char* log_output;       // Write scheduling events to this file as binary records (NULL: --verbose prints them)
+    LogLevel log_level;     // Lowest event level logged
+    unsigned log_categories;    // LogCategory mask of the events logged
+    char* decode_log;       // Print this binary log as text and exit (NULL: simulate)
+    bool profile;           // Print where the run spent its time (phase breakdown in SCHED_PROFILE builds)
 } CLIParams;
 
 /**
@@ -24,15 +49,56 @@ typedef struct {
  * Supports the following options:
  *   -c, --config FILE : Path to configuration file (required)
  *   --verbose         : Enable verbose output (optional)
+ *   --tick-engine     : Use the tick-by-tick reference engine (optional)
+ *   --cpus N          : Number of simulated CPUs sharing the ready queue (optional, default 1)
+ *   --per-cpu-queues  : Give each CPU its own run queue, with work stealing (optional)
+ *   --balance-interval N : Ticks between steal attempts with per-CPU queues (optional, default 1)
+ *   --migration-cost N   : Stall ticks paid by a CPU for each steal (optional, default 0)
+ *   --policies LIST   : Run a non-interactive sweep over these policies ("all" for every one)
+ *   --configs LIST    : Extra config files for the sweep (-c becomes optional)
+ *   --quanta LIST     : Quanta to sweep for quantum-based policies (default 2)
+ *   -j, --jobs N      : Worker threads for the sweep, or for reducing a single run's final metrics (default: one per online CPU)
+ *   --mlfq-levels N   : Number of MLFQ priority levels (optional, default 20)
+ *   --mlfq-quanta LIST     : MLFQ quantum per level, top level first (optional)
+ *   --mlfq-allotments LIST : MLFQ allotment per level, top level first (optional)
+ *   --mlfq-aging N|off     : Waiting ticks before an MLFQ promotion (optional, default 10)
+ *   --mlfq-boost N         : Move every MLFQ process to the top level every N ticks (optional)
+ *   --convert FILE    : Write the config to FILE and exit; text if FILE ends in ".conf", binary otherwise
+ *   --stream          : Read processes as they arrive, keeping only those in flight (config sorted by arrival)
+ *   --results FILE    : Write results to FILE as they complete; CSV if FILE ends in ".csv", binary otherwise
+ *   --telemetry FILE  : Sample queue lengths and CPU states into a CSV time series (optional)
+ *   --telemetry-stride N : Ticks between two telemetry samples (optional, default 1)
+ *   --log FILE        : Write scheduling events to FILE as binary records (optional)
+ *   --log-level LEVEL : Lowest level logged: debug, info, warn or error (optional, default debug)
+ *   --log-categories LIST : Events logged: arrival, dispatch, preemption, termination, migration or all
+ *   --decode-log FILE : Print a binary log as text and exit
+ *   --profile         : Print parse/simulate/render times, ticks/sec and decisions/sec (optional)
  *   -h, --help        : Display help message
  *
  * @param argc Argument count from main.
  * @param argv Argument vector from main.
- * @param params Pointer to CLIParams structure to be populated.
+ * @param params Pointer to CLIParams structure to be populated. Release it with
+ *               free_cli_params, whatever the return value.
  * @return 0 on success, -1 on error or if help was displayed.
  */
 int parse_arguments(int argc, char* argv[], CLIParams* params);
 
+/**
+ * @brief Frees the memory parse_arguments allocated inside a CLIParams structure.
+ * @param params The parsed parameters.
+ */
+void free_cli_params(CLIParams* params);
+
+/**
+ * @brief Splits a comma-separated list in place.
+ *
+ * @param list The list to split; its commas are replaced by string terminators.
+ * @param items Pointer set to a dynamically allocated array of pointers into list
+ *              (to be freed by the caller). Empty items are skipped.
+ * @return The number of items, or -1 on allocation failure.
+ */
+int split_comma_list(char* list, char*** items);
+
 /**
  * @brief Prompts the user to select a scheduling policy through an interactive menu.
  *
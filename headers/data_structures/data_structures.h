@@ -4,7 +4,7 @@
 #include "process.h"
 #include "queue.h"
 #include "stack.h"
-#include "min_heap.h"
-#include "max_heap.h"
+#include "heap.h"
+#include "timer_wheel.h"
 
 #endif
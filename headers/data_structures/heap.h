@@ -0,0 +1,50 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stdbool.h>
+
+#include "process.h"
+
+// 4-ary heap of processes, stored in one array; the root is the process that comes first
+typedef struct Heap Heap;
+
+
+// Comparator function type: returns <0 if a comes before b, 0 if they tie, >0 if b comes before a
+// (tied processes come out in an order set by the heap's shape)
+typedef int (*Comparator)(Process* a, Process* b);
+
+// Built-in orderings, compared inline instead of through a Comparator call.
+// Every built-in key ends with arrival time then process id, so pops never depend on the heap's shape.
+typedef enum {
+    HEAP_KEY_CUSTOM,                // The Comparator given to heap_create
+    HEAP_KEY_BURST,                 // Shortest burst_time first (SJF)
+    HEAP_KEY_REMAINING,             // Shortest remaining_burst_time, then least recently run (SRT)
+    HEAP_KEY_PRIORITY,              // Highest priority first (non-preemptive priority)
+    HEAP_KEY_PRIORITY_RECENCY       // Highest priority, then least recently run (preemptive priority)
+} HeapKey;
+
+// Creating a heap ordered by a custom comparator : Returns a pointer to an empty heap
+Heap* heap_create(Comparator comp);
+
+// Creating a heap ordered by a built-in key : Returns a pointer to an empty heap
+Heap* heap_create_keyed(HeapKey key);
+
+// Adding a process to the heap
+void heap_push(Heap* h, Process* p);
+
+// Pulling the first process from the heap (By removing it)
+Process* heap_pop(Heap* h);
+
+// Peeking at the first process of the heap (Without removing it)
+Process* heap_peek(const Heap* h);
+
+// Verifying if a heap is empty
+bool heap_is_empty(const Heap* h);
+
+// Getting the number of elements in the heap
+int heap_size(const Heap* h);
+
+// Freeing all the memory used by the heap;
+void heap_destroy(Heap* h);
+
+#endif
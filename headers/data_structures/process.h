@@ -20,7 +20,7 @@ typedef struct Process {
     int arrival_time; // Time at which the process arrives
     int burst_time; // Time required to complete the process
     int priority; // Priority of the process
-    int original_index; // To preserve config file order
+    int original_index; // To preserve config file order (also the process id: dense, 0..count-1)
 
     // Process Followup Parameters (During Execution)
     ProcessState state;
@@ -5,8 +5,7 @@
 
 #include "process.h"
 
-typedef struct QueueNode QueueNode;
-
+// Array-backed ring buffer: enqueue only allocates when the queue outgrows its capacity
 typedef struct Queue Queue;
 
 // Creating a queue : Returns a pointer to an empty queue
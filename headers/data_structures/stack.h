@@ -5,8 +5,7 @@
 
 #include "process.h"
 
-typedef struct StackNode StackNode;
-
+// Array-backed: push only allocates when the stack outgrows its capacity
 typedef struct Stack Stack;
 
 // Creating a stack : Returns a pointer to an empty stack
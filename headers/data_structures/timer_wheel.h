@@ -0,0 +1,54 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdbool.h>
+
+// Hierarchical timing wheel: 6 levels of 64 slots, level k slots spanning 64^k ticks.
+// A timer sits in the level of the highest 6-bit digit where its expiry differs from the
+// wheel's clock, so arming and cancelling are O(1), and moving the clock only cascades
+// the timers of the slots it enters. Expiry times up to 2^36 ticks ahead are supported.
+typedef struct TimerWheel TimerWheel;
+
+// A timer, owned and embedded by the caller; the wheel only links it
+typedef struct TimerNode {
+    long long expires;          // Absolute tick the timer fires on
+    struct TimerNode* next;
+    struct TimerNode* prev;
+    int level;                  // Wheel level holding the timer, -1 while not armed
+    int slot;
+} TimerNode;
+
+// Sentinel returned by timer_wheel_next_expiry when no timer is armed
+#define TIMER_WHEEL_NEVER (-1LL)
+
+// Creating a wheel whose clock starts at now : Returns a pointer to an empty wheel
+TimerWheel* timer_wheel_create(long long now);
+
+// Preparing a timer for its first use (not armed)
+void timer_init(TimerNode* timer);
+
+// Verifying if a timer is armed
+bool timer_is_armed(const TimerNode* timer);
+
+// Arming (or re-arming) a timer to fire at expires (expires >= the wheel's clock)
+void timer_wheel_arm(TimerWheel* wheel, TimerNode* timer, long long expires);
+
+// Disarming a timer (no effect if it is not armed)
+void timer_wheel_cancel(TimerWheel* wheel, TimerNode* timer);
+
+// Getting the earliest expiry of the armed timers, or TIMER_WHEEL_NEVER
+long long timer_wheel_next_expiry(const TimerWheel* wheel);
+
+// Moving the clock forward to now, which must not pass timer_wheel_next_expiry
+void timer_wheel_advance(TimerWheel* wheel, long long now);
+
+// Pulling one timer that expires at the current clock (By disarming it), or NULL if none is due
+TimerNode* timer_wheel_pop_expired(TimerWheel* wheel);
+
+// Getting the number of armed timers
+int timer_wheel_size(const TimerWheel* wheel);
+
+// Freeing the wheel (the timers belong to the caller)
+void timer_wheel_destroy(TimerWheel* wheel);
+
+#endif
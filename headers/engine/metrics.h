@@ -0,0 +1,139 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+
+
+// Latency histograms keep 2^LATENCY_HISTOGRAM_PRECISION_BITS exact buckets, then half that many
+// buckets per power of two: any recorded value is reported within 1/64 (1.6%) of itself
+#define LATENCY_HISTOGRAM_PRECISION_BITS 7
+#define LATENCY_HISTOGRAM_HALF_BUCKETS (1 << (LATENCY_HISTOGRAM_PRECISION_BITS - 1))
+#define LATENCY_HISTOGRAM_BUCKETS ((33 - LATENCY_HISTOGRAM_PRECISION_BITS) * LATENCY_HISTOGRAM_HALF_BUCKETS)
+
+
+/**
+ * @brief Running aggregate of one per-process metric (waiting, turnaround or response time).
+ *        Sums are exact 64-bit integers; the spread is kept as a sum of squared deviations
+ *        (Welford / Chan) so that accumulators of disjoint parts merge without loss.
+ */
+typedef struct {
+    long long count;    // Number of values folded in
+    long long sum;      // Exact sum of the values
+    int min;            // Smallest value (meaningless while count is 0)
+    int max;            // Largest value (meaningless while count is 0)
+    double m2;          // Sum of squared deviations from the mean
+} MetricAccumulator;
+
+/**
+ * @brief Final form of an accumulator, as reported in a SimulationResult.
+ */
+typedef struct {
+    long long count;
+    long long total;
+    int min;
+    int max;
+    double mean;
+    double variance;    // Population variance (0 when count < 2)
+} MetricSummary;
+
+
+/**
+ * @brief Fixed-memory log-bucketed histogram of non-negative time values (HDR-style).
+ *        Its size does not depend on the number of values, and two histograms merge by
+ *        adding their buckets, so runs simulated in parallel can be combined.
+ */
+typedef struct {
+    long long total_count;                          // Number of values recorded
+    int max;                                        // Largest value recorded (exact)
+    long long counts[LATENCY_HISTOGRAM_BUCKETS];    // Values recorded in each bucket
+} LatencyHistogram;
+
+/**
+ * @brief The tail of a latency histogram, as printed in reports.
+ */
+typedef struct {
+    int p50;
+    int p90;
+    int p99;
+    int p999;
+    int max;
+} LatencyPercentiles;
+
+
+/**
+ * @brief Resets an accumulator to hold no values.
+ * @param accumulator The accumulator to reset.
+ */
+void metric_init(MetricAccumulator* accumulator);
+
+/**
+ * @brief Folds one value into an accumulator (streaming runs, one process at a time).
+ * @param accumulator The accumulator to update.
+ * @param value The value to add.
+ */
+void metric_add(MetricAccumulator* accumulator, int value);
+
+/**
+ * @brief Folds another accumulator into the first, as if its values had been added one by one.
+ * @param accumulator The accumulator to update.
+ * @param other The accumulator to merge in (left unchanged).
+ */
+void metric_merge(MetricAccumulator* accumulator, const MetricAccumulator* other);
+
+/**
+ * @brief Folds a contiguous column of values into an accumulator.
+ *        Blocks of the column are reduced by a branch-free kernel the compiler can
+ *        vectorize; with threads > 1 and a large enough column, the blocks are shared
+ *        between that many threads (the caller included) and their partials merged.
+ * @param accumulator The accumulator to update.
+ * @param column The values.
+ * @param count Their number.
+ * @param threads Maximum number of threads to use (0 or 1: the calling thread only).
+ */
+void metric_add_column(MetricAccumulator* accumulator, const int* column, size_t count, int threads);
+
+/**
+ * @brief Computes the mean, variance and extremes of an accumulator.
+ * @param accumulator The accumulator to summarize.
+ * @return Its summary; every field is 0 if it holds no values.
+ */
+MetricSummary metric_summarize(const MetricAccumulator* accumulator);
+
+/**
+ * @brief Empties a latency histogram.
+ * @param histogram The histogram to reset.
+ */
+void latency_histogram_init(LatencyHistogram* histogram);
+
+/**
+ * @brief Counts one value in its bucket (negative values count as 0).
+ * @param histogram The histogram to update.
+ * @param value The value to record.
+ */
+void latency_histogram_record(LatencyHistogram* histogram, int value);
+
+/**
+ * @brief Adds every value of another histogram to the first.
+ * @param histogram The histogram to update.
+ * @param other The histogram to merge in (left unchanged).
+ */
+void latency_histogram_merge(LatencyHistogram* histogram, const LatencyHistogram* other);
+
+/**
+ * @brief Finds the value below or at which a given share of the recorded values lie.
+ *        Values under 2^LATENCY_HISTOGRAM_PRECISION_BITS are exact; larger ones are the
+ *        top of their bucket, never above the largest value recorded.
+ * @param histogram The histogram to query.
+ * @param percentile The share, from 0 to 100.
+ * @return The value at that percentile, or 0 if the histogram is empty.
+ */
+int latency_histogram_percentile(const LatencyHistogram* histogram, double percentile);
+
+/**
+ * @brief Reads p50, p90, p99, p99.9 and the maximum of a histogram.
+ * @param histogram The histogram to query.
+ * @return Its percentiles (all 0 if it is empty).
+ */
+LatencyPercentiles latency_histogram_percentiles(const LatencyHistogram* histogram);
+
+#endif
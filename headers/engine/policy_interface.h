@@ -21,6 +21,35 @@ typedef enum {
 // and also internal to each concrete policy's .c file.
 typedef struct Policy Policy;
 
+/**
+ * @brief Largest number of MLFQ priority levels.
+ */
+#define MLFQ_MAX_LEVELS 4096
+
+/**
+ * @brief MLFQ tuning. Zero fields keep the built-in defaults.
+ *        Per-level tables list the highest-priority level first; their last entry
+ *        repeats for the remaining (lower) levels.
+ */
+typedef struct {
+    int level_count;        // Number of priority levels (default 20, at most MLFQ_MAX_LEVELS)
+    const int* quanta;      // Quantum of each level (default: four tiers of 1x..4x the base quantum)
+    int quanta_count;
+    const int* allotments;  // Ticks a process may use at a level before it is demoted (default: quantum * allotment_ratio)
+    int allotment_count;
+    int allotment_ratio;    // Allotment as a multiple of the level's quantum (default 5)
+    int aging_threshold;    // Waiting ticks after which a process moves up one level (default 10, negative disables aging)
+    int boost_period;       // Every this many ticks, every process moves to the top level (default 0: never)
+} MlfqParameters;
+
+/**
+ * @brief Everything a policy may be configured with at creation.
+ */
+typedef struct {
+    int quantum;                // Time quantum for quantum-based policies, ignored by others
+    const MlfqParameters* mlfq; // MLFQ tuning (NULL keeps the defaults)
+} PolicyOptions;
+
 /**
  * @brief Creates and initializes a new instance of a policy based on its name.
  * @param policy_name The name of the policy to create (e.g., "fifo").
@@ -29,6 +58,15 @@ typedef struct Policy Policy;
  */
 Policy* policy_create(const char* policy_name, int quantum);
 
+/**
+ * @brief Creates and initializes a new instance of a policy with explicit options.
+ * @param policy_name The name of the policy to create (e.g., "mlfq").
+ * @param options The policy options; policies ignore the fields that do not concern them.
+ * @return A pointer to the policy's internal state (the handle), or NULL on error
+ *         (unknown policy or invalid options).
+ */
+Policy* policy_create_with_options(const char* policy_name, const PolicyOptions* options);
+
 /**
  * @brief Frees all resources used by the policy.
  * @param policy The policy handle to destroy.
@@ -80,4 +118,22 @@ int policy_get_quantum(Policy* policy, Process* process);
  */
 void policy_demote_process(Policy* policy, Process* process);
 
+/**
+ * @brief Reports how many upcoming executed ticks cannot change the policy's decisions.
+ *        Used by the event-driven engine to jump over ticks where nothing can happen.
+ *        A policy with neither ticks_until_event nor tick callbacks never has a pending event.
+ * @param policy The policy handle.
+ * @param running_process The process currently on the CPU (NULLable).
+ * @return The number of ticks that may be skipped, 0 if every tick must be simulated.
+ */
+int policy_ticks_until_event(Policy* policy, Process* running_process);
+
+/**
+ * @brief Advances the policy's internal clock by several executed ticks at once.
+ *        Only valid for tick counts not exceeding policy_ticks_until_event.
+ * @param policy The policy handle.
+ * @param ticks The number of executed ticks to account for.
+ */
+void policy_advance(Policy* policy, int ticks);
+
 #endif // POLICY_INTERFACE_H
@@ -0,0 +1,104 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <time.h>
+
+// Engine instrumentation. Builds with SCHED_PROFILE defined (make PROFILE=1) time each phase
+// of a simulated tick and count the policy vtable calls of the runs given an EngineProfile;
+// in other builds every PROFILE_* macro expands to nothing and only the coarse fields
+// (stage wall times, ticks, decisions) are filled.
+
+/**
+ * @brief The timed parts of the engine loop.
+ */
+typedef enum {
+    PROFILE_PHASE_ARRIVALS = 0,         // Admitting the processes that arrive on the tick
+    PROFILE_PHASE_QUANTUM_EXPIRY,       // Preempting the processes whose quantum is used up
+    PROFILE_PHASE_NEEDS_RESCHEDULE,     // Asking each CPU's policy whether to reschedule
+    PROFILE_PHASE_GET_NEXT,             // Requeuing preempted processes and picking (or stealing) the next ones
+    PROFILE_PHASE_EXECUTION,            // Running the tick on every CPU, terminations included (Gantt appends too)
+    PROFILE_PHASE_GANTT,                // Appending to the Gantt charts (also counted in execution and quiet windows)
+    PROFILE_PHASE_QUIET_WINDOW,         // Event-driven jumps over ticks where nothing can happen
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+/**
+ * @brief The policy vtable entry points, counted by the policy_* wrappers.
+ */
+typedef enum {
+    PROFILE_CALL_ADD_PROCESS = 0,
+    PROFILE_CALL_GET_NEXT_PROCESS,
+    PROFILE_CALL_TICK,
+    PROFILE_CALL_NEEDS_RESCHEDULE,
+    PROFILE_CALL_GET_QUANTUM,
+    PROFILE_CALL_DEMOTE_PROCESS,
+    PROFILE_CALL_TICKS_UNTIL_EVENT,
+    PROFILE_CALL_ADVANCE,
+    PROFILE_CALL_COUNT
+} ProfileCall;
+
+/**
+ * @brief Wall-clock stages of a command-line run.
+ */
+typedef enum {
+    PROFILE_STAGE_PARSE = 0,    // Loading the workload
+    PROFILE_STAGE_SIMULATE,     // The run_simulation* call
+    PROFILE_STAGE_RENDER,       // Printing the metrics and the Gantt chart
+    PROFILE_STAGE_COUNT
+} ProfileStage;
+
+/**
+ * @brief Where a profiled run accumulates its counters. Several runs may share one, one at a time.
+ */
+typedef struct {
+    long long phase_ns[PROFILE_PHASE_COUNT];    // Time spent in each phase (SCHED_PROFILE builds)
+    long long phase_count[PROFILE_PHASE_COUNT]; // Times each phase ran (SCHED_PROFILE builds)
+    long long calls[PROFILE_CALL_COUNT];        // Policy vtable calls (SCHED_PROFILE builds)
+    long long stage_ns[PROFILE_STAGE_COUNT];    // Wall time of each stage, measured by the caller
+    long long ticks;                            // Simulated ticks, stepped or skipped
+    long long stepped_ticks;                    // Ticks simulated one at a time (SCHED_PROFILE builds)
+    long long decisions;                        // Scheduling decisions: picks of a next process
+} EngineProfile;
+
+
+/**
+ * @brief Reads the monotonic clock.
+ * @return Nanoseconds since an arbitrary origin.
+ */
+static inline long long profile_clock_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+#ifdef SCHED_PROFILE
+
+// The profile of the run executing on this thread (NULL: not profiled)
+extern _Thread_local EngineProfile* profile_active;
+
+#define PROFILE_BEGIN(timer) \
+    long long timer = profile_active ? profile_clock_ns() : 0
+#define PROFILE_END(timer, phase) \
+    do { if (profile_active) { profile_active->phase_ns[phase] += profile_clock_ns() - (timer); profile_active->phase_count[phase]++; } } while (0)
+#define PROFILE_CALL(call) \
+    do { if (profile_active) profile_active->calls[call]++; } while (0)
+#define PROFILE_ADD(field, amount) \
+    do { if (profile_active) profile_active->field += (amount); } while (0)
+
+#else
+
+#define PROFILE_BEGIN(timer)
+#define PROFILE_END(timer, phase)
+#define PROFILE_CALL(call)
+#define PROFILE_ADD(field, amount)
+
+#endif
+
+/**
+ * @brief Makes a profile receive the counters of the runs executing on this thread.
+ * @param profile The profile (NULL stops profiling).
+ * @return The profile it replaces, to restore once the run is over.
+ */
+EngineProfile* profile_attach(EngineProfile* profile);
+
+#endif
@@ -3,47 +3,152 @@
 
 #include "../data_structures/process.h"
 #include "policy_interface.h" 
+#include "workload.h"
+#include "metrics.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "../output/logger.h"
 
 #include <stdbool.h>
 
 
 /**
- * @brief An event for building a Gantt chart.
+ * @brief Process id used in Gantt data for ticks where the CPU is idle.
+ */
+#define GANTT_IDLE_ID (-1)
+
+/**
+ * @brief Process id used in Gantt data for ticks a CPU spends migrating a stolen process.
+ */
+#define GANTT_MIGRATION_ID (-2)
+
+
+/**
+ * @brief An event for building a Gantt chart (one per tick).
+ * Kept for callers that want the per-tick view; see expand_gantt_segments.
  */
 typedef struct {
     int time;
-    char process_name[32];
+    int process_id;             // Process original_index, GANTT_IDLE_ID or GANTT_MIGRATION_ID
+    char process_name[32];      // Resolved name (or "IDLE" / "MIGRATE")
 } GanttEvent;
 
 
+/**
+ * @brief A run of consecutive ticks spent on the same process (or idle).
+ * The engine records the timeline as segments, so its size follows the number
+ * of context switches instead of the simulated duration.
+ */
+typedef struct {
+    int start_time;         // First tick of the run
+    int end_time;           // Tick right after the run (exclusive)
+    int process_id;         // Process original_index, GANTT_IDLE_ID or GANTT_MIGRATION_ID
+} GanttSegment;
+
+
+/**
+ * @brief The Gantt timeline of one simulated CPU.
+ */
+typedef struct {
+    GanttSegment* segments;     // Run segments of this CPU, in time order
+    int segment_count;
+    long long busy_time;        // Ticks this CPU spent running a process
+    float utilization;          // busy_time over the simulated duration, in percent
+    int steals;                 // Processes this CPU pulled from another CPU's run queue
+    long long migration_time;   // Ticks this CPU spent paying the migration cost of its steals
+} CpuLane;
+
+
+/**
+ * @brief A run of consecutive ticks with the same run-queue imbalance.
+ * Only recorded with per-CPU run queues.
+ */
+typedef struct {
+    int start_time;
+    int end_time;           // Exclusive
+    int imbalance;          // Largest minus smallest CPU load (queued + running)
+} ImbalanceSegment;
+
+
 /**
  * @brief Callback function type for live simulation updates.
  * Called after each simulation tick to update UI.
  * @param current_time Current simulation time
  * @param all_processes Array of all processes
  * @param process_count Number of processes
- * @param running_process Currently running process (NULL if CPU idle)
- * @param gantt_events Current Gantt events
- * @param gantt_count Number of Gantt events
+ * @param running_process Process currently running on CPU 0 (NULL if idle)
+ * @param gantt_segments Current Gantt segments of CPU 0 (the last one may still grow; only that one when a sink takes segments)
+ * @param gantt_segment_count Number of Gantt segments
  */
 typedef void (*SimulationTickCallback)(
     int current_time,
     Process* all_processes,
     int process_count,
     Process* running_process,
-    GanttEvent* gantt_events,
-    int gantt_count
+    GanttSegment* gantt_segments,
+    int gantt_segment_count
 );
 
+/**
+ * @brief A source handing processes to a streaming run, in non-decreasing arrival order.
+ *        The engine pulls the next process only once the previous one has arrived.
+ */
+typedef struct {
+    int (*next)(void* context, Process* process);   // Fills the next process: 1, 0 at the end, -1 on error
+    void* context;                                  // Passed back to next
+} ProcessSource;
+
+
+/**
+ * @brief Receives a run's results as they are produced instead of keeping them resident.
+ *        With on_segment set, each Gantt segment is handed over when it closes and the
+ *        result's lanes keep none. Streaming runs free each process once on_process returns.
+ */
+typedef struct ResultsSink {
+    void (*on_process)(void* context, const Process* process);                 // Optional: each process as it terminates, final metrics set
+    void (*on_segment)(void* context, int cpu, const GanttSegment* segment);   // Optional: each Gantt segment once it can no longer grow
+    void* context;                                                             // Passed back to both callbacks
+} ResultsSink;
+
+
+/**
+ * @brief Selects how the engine advances simulated time.
+ */
+typedef enum {
+    SIM_ENGINE_EVENT = 0,   // Default: jumps straight to the next decision point
+    SIM_ENGINE_TICK         // Reference mode: simulates every time unit one by one
+} SimEngineMode;
+
+
+/**
+ * @brief Selects how ready processes are shared between CPUs.
+ */
+typedef enum {
+    SIM_QUEUE_GLOBAL = 0,   // Default: every CPU dispatches from one policy instance
+    SIM_QUEUE_PER_CPU       // Each CPU owns a policy instance; idle CPUs steal work
+} SimQueueModel;
+
+
 /**
  * @brief Parameters for a simulation run, passed from main to the engine.
  */
 typedef struct {
-    const char* config_filepath;
+    const char* config_filepath;           // Only used by run_simulation (run_simulation_on takes a Workload)
     const char* policy_name;
     int quantum;
-    bool verbose;
-    SimulationTickCallback tick_callback;  // Optional: for live UI updates
+    bool verbose;                          // Prints start/end messages and logs every event (through logger, or a text logger on stdout)
+    Logger* logger;                        // Optional: receives scheduling events, whatever verbose says (one run at a time)
+    SimulationTickCallback tick_callback;  // Optional: for live UI updates (forces per-tick stepping)
+    SimEngineMode engine_mode;             // Event-driven unless the tick reference loop is requested
+    int cpu_count;                         // Number of simulated CPUs (0 means 1)
+    SimQueueModel queue_model;             // One shared ready queue, or one run queue per CPU
+    int balance_interval;                  // Per-CPU queues: idle CPUs may steal on ticks that are multiples of this (0: never)
+    int migration_cost;                    // Per-CPU queues: ticks a CPU spends before running a stolen process
+    const MlfqParameters* mlfq;            // MLFQ levels, quanta, allotments, aging and boost (NULL: defaults)
+    const ResultsSink* sink;               // Optional: receives processes and Gantt segments as they complete
+    int metrics_threads;                   // Threads reducing the final metrics of very large runs (0 or 1: the simulating thread)
+    int telemetry_stride;                  // Optional: sample queue lengths and CPU states every this many ticks (0: off)
+    EngineProfile* profile;                // Optional: receives the simulated ticks, and phase timings and policy call counts in SCHED_PROFILE builds
 } SimParameters;
 
 
@@ -55,20 +160,74 @@ typedef struct {
     int process_count;
     float average_turnaround_time;
     float average_waiting_time;
-    float cpu_utilization;
-    GanttEvent* gantt_chart;
-    int gantt_event_count;
+    float average_response_time;
+    float cpu_utilization;      // Busy ticks over (duration * cpu_count), in percent
+    MetricSummary waiting_summary;      // Exact totals, extremes and variance of the waiting times
+    MetricSummary turnaround_summary;   // Same for turnaround times
+    MetricSummary response_summary;     // Same for response times (first dispatch - arrival)
+    LatencyHistogram waiting_histogram;     // Distribution of the waiting times (see latency_histogram_percentiles)
+    LatencyHistogram response_histogram;    // Distribution of the response times
+    LatencyHistogram turnaround_histogram;  // Distribution of the turnaround times
+    Process** process_by_id;    // process_by_id[id] points into processes (id = original_index)
+    GanttSegment* gantt_segments;   // CPU 0's lane (alias of cpu_lanes[0].segments)
+    int gantt_segment_count;
+    int cpu_count;
+    CpuLane* cpu_lanes;         // One lane per CPU
+    int migration_count;        // Processes moved between run queues (per-CPU queues only)
+    float average_imbalance;    // Time-weighted mean of the run-queue imbalance
+    int max_imbalance;
+    ImbalanceSegment* imbalance_segments;   // Imbalance over time (per-CPU queues only, else NULL)
+    int imbalance_segment_count;
+    int peak_resident_processes;    // Streaming runs: most processes held at once (arrived, not yet finished)
+    TelemetrySeries* telemetry;     // Samples taken every telemetry_stride ticks (NULL when telemetry is off)
 } SimulationResult;
 
 
 /**
- * @brief Initializes and executes the CPU scheduling simulation.
+ * @brief Parses params->config_filepath and executes the CPU scheduling simulation on it.
+ *        A run keeps all of its state in its own allocations and only reads the policy
+ *        registry, so any number of simulations may run concurrently in one process.
  * @param params A pointer to the SimParameters struct containing all simulation settings.
  * @return A pointer to a dynamically allocated SimulationResult structure, or NULL on error.
  */
 SimulationResult* run_simulation(const SimParameters* params);
 
 
+/**
+ * @brief Executes the CPU scheduling simulation on a workload parsed beforehand.
+ *        The workload is not modified and can be reused for any number of runs,
+ *        including concurrent runs on several threads.
+ * @param workload The workload to simulate.
+ * @param params Simulation settings (config_filepath is ignored).
+ * @return A pointer to a dynamically allocated SimulationResult structure, or NULL on error.
+ */
+SimulationResult* run_simulation_on(const Workload* workload, const SimParameters* params);
+
+
+/**
+ * @brief Simulates params->config_filepath without loading it: processes are read from the
+ *        file as their arrival time is reached, and released once they terminate.
+ *        The file must list processes in non-decreasing arrival order.
+ * @param params Simulation settings (tick_callback is not called in streaming runs).
+ * @return A pointer to a dynamically allocated SimulationResult structure, or NULL on error.
+ *         Its processes and process_by_id are NULL; process_count counts the simulated processes.
+ */
+SimulationResult* run_simulation_streamed(const SimParameters* params);
+
+
+/**
+ * @brief Simulates the processes handed out by a source, holding only those in flight.
+ *        A process is pulled when its arrival time is reached, and handed to params->sink
+ *        and released when it terminates, so memory follows the number of processes
+ *        between arrival and termination instead of the length of the trace.
+ * @param source The process source (arrival times must not decrease).
+ * @param params Simulation settings (config_filepath is ignored, tick_callback is not called).
+ * @return A pointer to a dynamically allocated SimulationResult structure, or NULL on error.
+ *         Its processes and process_by_id are NULL; process_count counts the simulated processes.
+ */
+SimulationResult* run_simulation_from_source(const ProcessSource* source, const SimParameters* params);
+
+
 /**
  * @brief Frees all memory associated with a SimulationResult structure.
  * @param results The results structure to free.
@@ -76,4 +235,15 @@ SimulationResult* run_simulation(const SimParameters* params);
 void free_simulation_results(SimulationResult* results);
 
 
+/**
+ * @brief Expands the result's run segments back into one GanttEvent per tick.
+ *        Compatibility helper for callers written against the per-tick chart.
+ * @param results The simulation results holding the segments and the process table.
+ * @param event_count Pointer to store the number of generated events.
+ * @return A dynamically allocated array of events (to be freed by the caller), or NULL
+ *         (also for streaming results, which keep no process table).
+ */
+GanttEvent* expand_gantt_segments(const SimulationResult* results, int* event_count);
+
+
 #endif // SCHEDULER_ENGINE_H
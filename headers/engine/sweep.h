@@ -0,0 +1,64 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include "scheduler_engine.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Every combination of configs, policies and quanta to simulate.
+ */
+typedef struct {
+    const char** configs;       // Config file paths
+    int config_count;
+    const char** policies;      // Registered policy names
+    int policy_count;
+    const int* quanta;          // Quanta to try with quantum-based policies
+    int quantum_count;
+    int jobs;                   // Worker threads (0 means one per online CPU)
+    SimParameters base;         // Settings shared by every run (engine mode, CPUs, queues...)
+} SweepPlan;
+
+
+/**
+ * @brief The outcome of one run of a sweep.
+ */
+typedef struct {
+    const char* config_filepath;
+    const char* policy_name;
+    int quantum;                // 0 for policies that take no quantum
+    bool ok;                    // False if the config or the run failed
+    float average_waiting_time;
+    float average_turnaround_time;
+    int p99_waiting_time;       // 99th percentile of the waiting times
+    float cpu_utilization;
+    int makespan;               // Finish time of the last process
+    int migration_count;
+    double run_ms;              // Wall time of the simulation itself
+} SweepRow;
+
+
+/**
+ * @brief Tells whether a policy uses the time quantum (and is therefore swept over quanta).
+ * @param policy_name The policy name.
+ * @return true for quantum-based policies (rr, mlfq).
+ */
+bool policy_takes_quantum(const char* policy_name);
+
+
+/**
+ * @brief Runs every combination of the plan on a pool of worker threads.
+ *
+ * Each config is parsed once and shared, read-only, by all of its runs. Rows
+ * come back in config, policy, quantum order whatever the order the workers
+ * finished in.
+ *
+ * @param plan The combinations to run.
+ * @param row_count Pointer to store the number of rows.
+ * @return A dynamically allocated array of rows (to be freed by the caller), or NULL on error.
+ */
+SweepRow* run_sweep(const SweepPlan* plan, int* row_count);
+
+
+#endif // SWEEP_H
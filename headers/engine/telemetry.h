@@ -0,0 +1,65 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Time series sampled by the engine every `stride` ticks, one column per quantity.
+ *        Sample i describes tick time[i] after its dispatch decisions, while it executes.
+ */
+typedef struct {
+    int stride;                 // Ticks between two samples
+    int cpu_count;              // Width of a cpu_busy row
+    int sample_count;
+    int capacity;               // Allocated samples per column
+    int* time;                  // Tick of each sample (multiples of stride)
+    int* ready_length;          // Processes waiting in the run queues (all CPUs)
+    int* arrived;               // Processes arrived so far
+    int* in_system;             // Processes arrived and not finished (waiting or running)
+    unsigned char* cpu_busy;    // sample_count x cpu_count, row-major: 1 if the CPU was running a process
+} TelemetrySeries;
+
+
+/**
+ * @brief Creates an empty series.
+ * @param stride Ticks between two samples (> 0).
+ * @param cpu_count Number of simulated CPUs (> 0).
+ * @return The series, or NULL on allocation failure.
+ */
+TelemetrySeries* telemetry_create(int stride, int cpu_count);
+
+/**
+ * @brief Allocates room for a number of samples up front, so appending never moves the columns.
+ * @param series The series to grow.
+ * @param capacity Samples to make room for (no effect if already that large).
+ * @return true OTHERWISE false (the series stays usable).
+ */
+bool telemetry_reserve(TelemetrySeries* series, int capacity);
+
+/**
+ * @brief Appends one sample, growing the columns if needed.
+ * @param series The series to extend.
+ * @param time The sampled tick.
+ * @param ready_length Processes waiting in the run queues.
+ * @param arrived Processes arrived so far.
+ * @param in_system Processes arrived and not finished.
+ * @return The sample's cpu_busy row (cpu_count bytes, zeroed) for the caller to fill, or NULL on allocation failure.
+ */
+unsigned char* telemetry_append(TelemetrySeries* series, int time, int ready_length, int arrived, int in_system);
+
+/**
+ * @brief Counts the CPUs that were busy in one sample.
+ * @param series The series.
+ * @param sample The sample index (0 <= sample < sample_count).
+ * @return The number of busy CPUs.
+ */
+int telemetry_busy_cpus(const TelemetrySeries* series, int sample);
+
+/**
+ * @brief Frees a series and its columns (NULL is ignored).
+ * @param series The series to free.
+ */
+void telemetry_free(TelemetrySeries* series);
+
+#endif
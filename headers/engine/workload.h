@@ -0,0 +1,46 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "../data_structures/process.h"
+#include "../parser/config_parser.h"
+
+
+/**
+ * @brief A parsed configuration, loaded once and shared by any number of runs.
+ *
+ * The workload is immutable once loaded: every simulation copies the processes
+ * it needs into its own results, so the same workload can be simulated again with
+ * another policy or quantum without touching the config file.
+ */
+typedef struct {
+    Process* processes;         // Processes in config order (id = original_index)
+    int process_count;
+    int* arrival_order;         // Ids sorted by arrival time (ties in config order)
+    ParseStats parse_stats;     // Size and duration of the config parse
+} Workload;
+
+
+/**
+ * @brief Parses a configuration file into a new workload.
+ * @param filepath Path to the configuration file.
+ * @return A dynamically allocated workload, or NULL on error or if no processes were found.
+ */
+Workload* workload_load(const char* filepath);
+
+
+/**
+ * @brief Frees a workload and everything it owns.
+ * @param workload The workload to free (may be NULL).
+ */
+void workload_free(Workload* workload);
+
+
+/**
+ * @brief Copies the workload's processes in arrival order, ready to be simulated.
+ * @param workload The source workload.
+ * @return A dynamically allocated array of process_count processes, or NULL on error.
+ */
+Process* workload_copy_by_arrival(const Workload* workload);
+
+
+#endif // WORKLOAD_H
@@ -11,6 +11,8 @@
  *        |-|-|-| ...
  * P1     █ █ . . ...
  * P2     . . █ █ ...
+ *
+ * With several CPUs, each busy cell shows the number of the CPU that ran it.
  * 
  * @param results Pointer to the simulation results containing events and process info.
  */
@@ -0,0 +1,174 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Scheduling events are appended as fixed-size binary records to a per-logger ring buffer;
+// a background thread drains it to the output, either as raw records (a binary log that
+// log_decode_file renders later) or already decoded to text.
+// Binary log layout (version 1, native byte order): LogFileHeader, then LogRecord after LogRecord
+
+#define LOG_FILE_MAGIC "SCHEDLG\0"
+#define LOG_FILE_MAGIC_SIZE 8
+#define LOG_FILE_VERSION 1
+#define LOG_FILE_BYTE_ORDER 0x01020304u
+
+// Records the ring buffer holds when no capacity is given
+#define LOG_DEFAULT_CAPACITY 65536
+
+/**
+ * @brief Severity of an event; a logger drops events below its level.
+ */
+typedef enum {
+    LOG_LEVEL_DEBUG = 0,    // Every decision (dispatches, quantum expiries)
+    LOG_LEVEL_INFO,         // Process lifecycle (arrivals, completions, migrations)
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR
+} LogLevel;
+
+/**
+ * @brief Bit flags grouping events; a logger drops events outside its category mask.
+ */
+typedef enum {
+    LOG_CATEGORY_ARRIVAL     = 1 << 0,
+    LOG_CATEGORY_DISPATCH    = 1 << 1,
+    LOG_CATEGORY_PREEMPTION  = 1 << 2,
+    LOG_CATEGORY_TERMINATION = 1 << 3,
+    LOG_CATEGORY_MIGRATION   = 1 << 4,
+    LOG_CATEGORY_ALL         = (1 << 5) - 1
+} LogCategory;
+
+/**
+ * @brief The scheduling events the engine reports.
+ */
+typedef enum {
+    LOG_EVENT_ARRIVAL = 0,      // A process entered a run queue
+    LOG_EVENT_DISPATCH,         // A process started running on a CPU
+    LOG_EVENT_QUANTUM_EXPIRED,  // A process used up its time slice
+    LOG_EVENT_FINISH,           // A process terminated
+    LOG_EVENT_STEAL,            // An idle CPU took a process from another run queue
+    LOG_EVENT_COUNT
+} LogEvent;
+
+/**
+ * @brief How a logger writes what it drains.
+ */
+typedef enum {
+    LOG_FORMAT_TEXT = 0,    // One decoded line per record
+    LOG_FORMAT_BINARY       // LogFileHeader, then the raw records
+} LogFormat;
+
+/**
+ * @brief One event, as stored in the ring buffer and in binary logs.
+ */
+typedef struct {
+    int32_t time;           // Simulated time of the event
+    uint8_t event;          // LogEvent
+    uint8_t level;          // LogLevel
+    int16_t cpu;            // CPU involved, -1 if none (or single CPU)
+    int32_t process_id;     // original_index of the process
+    int32_t detail;         // LOG_EVENT_STEAL: the CPU robbed; 0 otherwise
+    char name[32];          // Name of the process (processes of streamed runs are gone when the record is decoded)
+} LogRecord;
+
+/**
+ * @brief Header of a binary log.
+ */
+typedef struct {
+    char magic[LOG_FILE_MAGIC_SIZE];    // LOG_FILE_MAGIC
+    uint32_t version;                   // LOG_FILE_VERSION
+    uint32_t byte_order;                // LOG_FILE_BYTE_ORDER as written by the producing machine
+    uint32_t record_size;               // sizeof(LogRecord)
+    uint32_t reserved;
+} LogFileHeader;
+
+typedef struct Logger Logger;
+
+
+/**
+ * @brief Creates a logger and starts its flush thread. Every level and category is enabled.
+ * @param output Where drained records go (not closed by the logger).
+ * @param format Text lines or binary records.
+ * @param capacity Records the ring buffer holds (0: LOG_DEFAULT_CAPACITY).
+ * @return A logger to release with logger_close, or NULL on error.
+ */
+Logger* logger_open(FILE* output, LogFormat format, size_t capacity);
+
+/**
+ * @brief Sets the lowest level kept; takes effect for the next event, from any thread.
+ * @param logger The logger.
+ * @param level The lowest level to keep.
+ */
+void logger_set_level(Logger* logger, LogLevel level);
+
+/**
+ * @brief Sets the categories kept; takes effect for the next event, from any thread.
+ * @param logger The logger.
+ * @param categories A mask of LogCategory flags.
+ */
+void logger_set_categories(Logger* logger, unsigned categories);
+
+/**
+ * @brief Appends one event if the level and category filters keep it.
+ *        Only one thread may log to a given logger. When the ring is full the caller
+ *        waits for the flush thread, so no event is ever dropped.
+ * @param logger The logger.
+ * @param event The event.
+ * @param time Simulated time of the event.
+ * @param cpu CPU involved, -1 if none.
+ * @param process_id original_index of the process.
+ * @param name Name of the process.
+ * @param detail Event-specific value (LOG_EVENT_STEAL: the CPU robbed).
+ */
+void logger_event(Logger* logger, LogEvent event, int time, int cpu, int process_id, const char* name, int detail);
+
+/**
+ * @brief Waits until every event logged so far has been written to the output.
+ * @param logger The logger.
+ */
+void logger_flush(Logger* logger);
+
+/**
+ * @brief Drains the ring buffer, stops the flush thread and frees the logger.
+ * @param logger The logger (may be NULL).
+ * @return 0 if every record was written, -1 otherwise.
+ */
+int logger_close(Logger* logger);
+
+/**
+ * @brief Renders one record as a line of text (without the newline).
+ * @param record The record.
+ * @param buffer Where to write the text.
+ * @param size Size of the buffer.
+ * @return The length of the text (truncated to size - 1 like snprintf).
+ */
+int log_record_format(const LogRecord* record, char* buffer, size_t size);
+
+/**
+ * @brief Parses a level name.
+ * @param name "debug", "info", "warn" or "error".
+ * @param level Where to store the level.
+ * @return true OTHERWISE false
+ */
+bool log_level_parse(const char* name, LogLevel* level);
+
+/**
+ * @brief Parses a comma-separated list of category names.
+ * @param list Names among "arrival", "dispatch", "preemption", "termination", "migration", or "all".
+ * @param categories Where to store the mask.
+ * @return true OTHERWISE false
+ */
+bool log_categories_parse(const char* list, unsigned* categories);
+
+/**
+ * @brief Renders a binary log as text, one line per record.
+ * @param input The binary log, positioned at its header.
+ * @param output Where to write the text.
+ * @return The number of records decoded, or -1 if the log is not valid.
+ */
+long long log_decode_file(FILE* input, FILE* output);
+
+#endif
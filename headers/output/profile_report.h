@@ -0,0 +1,17 @@
+#ifndef PROFILE_REPORT_H
+#define PROFILE_REPORT_H
+
+#include "../engine/profile.h"
+
+/**
+ * @brief Prints where a profiled run spent its time to stdout.
+ *
+ * Lists the parse, simulate and render wall times with the simulated ticks and
+ * scheduling decisions per second of simulation, then (in SCHED_PROFILE builds)
+ * the time and count of each engine phase and the policy vtable call counts.
+ *
+ * @param profile The profile filled by the run and its caller.
+ */
+void print_profile_report(const EngineProfile* profile);
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef RESULTS_WRITER_H
+#define RESULTS_WRITER_H
+
+#include <stdint.h>
+
+#include "../engine/scheduler_engine.h"
+
+// Results file layouts, written as the simulation runs (processes in termination order,
+// segments in the order they close, both kinds interleaved):
+//   CSV: two commented header lines, then "process,..." and "segment,..." rows
+//   Binary (version 1, native byte order): ResultsBinaryHeader, then records that each
+//   start with their uint32_t kind (ResultsProcessRecord or ResultsSegmentRecord)
+
+#define RESULTS_BINARY_MAGIC "SCHEDRS\0"
+#define RESULTS_BINARY_MAGIC_SIZE 8
+#define RESULTS_BINARY_VERSION 1
+#define RESULTS_BINARY_BYTE_ORDER 0x01020304u
+
+/**
+ * @brief Format of a results file.
+ */
+typedef enum {
+    RESULTS_FORMAT_CSV = 0,
+    RESULTS_FORMAT_BINARY
+} ResultsFormat;
+
+/**
+ * @brief Kind tag starting every record of a binary results file.
+ */
+typedef enum {
+    RESULTS_RECORD_PROCESS = 1,
+    RESULTS_RECORD_SEGMENT = 2
+} ResultsRecordKind;
+
+typedef struct {
+    char magic[RESULTS_BINARY_MAGIC_SIZE];  // RESULTS_BINARY_MAGIC
+    uint32_t version;                       // RESULTS_BINARY_VERSION
+    uint32_t byte_order;                    // RESULTS_BINARY_BYTE_ORDER as written by the producing machine
+} ResultsBinaryHeader;
+
+typedef struct {
+    uint32_t kind;              // RESULTS_RECORD_PROCESS
+    int32_t process_id;         // original_index
+    int32_t arrival_time;
+    int32_t burst_time;
+    int32_t priority;
+    int32_t start_time;
+    int32_t finish_time;
+    int32_t waiting_time;
+    int32_t turnaround_time;
+    int32_t response_time;
+    char name[32];
+} ResultsProcessRecord;
+
+typedef struct {
+    uint32_t kind;              // RESULTS_RECORD_SEGMENT
+    int32_t cpu;
+    int32_t start_time;
+    int32_t end_time;           // Exclusive
+    int32_t process_id;         // original_index, GANTT_IDLE_ID or GANTT_MIGRATION_ID
+} ResultsSegmentRecord;
+
+
+/**
+ * @brief Creates a results sink writing every finished process and closed Gantt segment to a file.
+ *        Pass it as SimParameters.sink; it holds nothing but its output buffer.
+ * @param filepath Path of the file to create (replaced if it exists).
+ * @param format CSV or binary records.
+ * @return A dynamically allocated sink to release with results_writer_close, or NULL on error.
+ */
+ResultsSink* results_writer_open(const char* filepath, ResultsFormat format);
+
+
+/**
+ * @brief Flushes and closes a results file, then frees its sink.
+ * @param sink A sink created by results_writer_open (may be NULL).
+ * @return 0 if every record was written, -1 otherwise.
+ */
+int results_writer_close(ResultsSink* sink);
+
+
+/**
+ * @brief Writes a telemetry series as CSV: a header line, then one row per sample with
+ *        time, ready_length, arrived, in_system, busy_cpus and one 0/1 digit per CPU.
+ * @param filepath Path of the file to create (replaced if it exists).
+ * @param series The series to write.
+ * @return 0 on success, -1 otherwise.
+ */
+int write_telemetry_csv(const char* filepath, const TelemetrySeries* series);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef SWEEP_TABLE_H
+#define SWEEP_TABLE_H
+
+#include "../engine/sweep.h"
+
+/**
+ * @brief Prints the results of a sweep as one table to stdout.
+ *
+ * Format:
+ * | Config | Policy | Quantum | Avg Wait | Avg Turnaround | CPU Util | Makespan | Run ms |
+ *
+ * @param rows The sweep rows, in the order they should be listed.
+ * @param row_count Number of rows.
+ * @param wall_ms Wall time of the whole sweep, printed under the table.
+ */
+void print_sweep_table(const SweepRow* rows, int row_count, double wall_ms);
+
+#endif
@@ -1,14 +1,91 @@
 #ifndef CONFIG_PARSER_H
 #define CONFIG_PARSER_H
 
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
 #include "../data_structures/data_structures.h"
 
+// What a parse cost, for throughput reporting
+typedef struct {
+    size_t bytes; // Size of the config text that was parsed
+    double seconds; // Wall time from opening the file to returning the processes
+    bool mapped; // true if the file was memory-mapped, false if it had to be read into memory
+    bool binary; // true if the file was a binary workload (see workload_binary.h)
+    int threads; // Threads the parse was split across
+} ParseStats;
+
+// Reads either a text config or a binary workload (workload_binary.h), told apart by content
 // Params:
 // @filepath: Path to the configuration file
 // @process_count: Pointer to save the number of parsed processes
 
 // Return:
-// Dynamically-allocated table of parsed processes OTHERWISE NULL 
+// Dynamically-allocated table of parsed processes OTHERWISE NULL
 Process* parse_config_file(const char* filepath, int* process_count);
 
+// Same as parse_config_file, also measuring the parse
+// Regular files are memory-mapped and tokenized in place, on one thread per online CPU
+// (at most one per 4 MB); other files are read into memory first
+// Params:
+// @stats: Pointer to save the parse statistics (may be NULL)
+Process* parse_config_file_with_stats(const char* filepath, int* process_count, ParseStats* stats);
+
+// Parses config text already in memory, without copying or modifying it
+// The Process array is sized once from a pre-scan of the text
+// Large buffers are split across threads, as parse_config_buffer_parallel does with thread_count = 0
+// Params:
+// @data: The config text (does not need to be NUL-terminated)
+// @size: Its length in bytes
+// @process_count: Pointer to save the number of parsed processes
+
+// Return:
+// Dynamically-allocated table of parsed processes OTHERWISE NULL
+Process* parse_config_buffer(const char* data, size_t size, int* process_count);
+
+// Parses config text on several threads
+// The text is cut after "}" lines into thread_count chunks, each parsed into its own array,
+// then merged in file order (original_index counts across the whole file). A chunk that did
+// not start or end outside every block (a comment block spanning a cut, or a "}" inside
+// one) is parsed again on the calling thread from the real parser state, so the results,
+// error messages and line numbers are exactly those of a single-threaded parse.
+// Params:
+// @thread_count: Number of threads (<= 0 picks one per online CPU, at most one per 4 MB)
+
+// Return:
+// Dynamically-allocated table of parsed processes OTHERWISE NULL
+Process* parse_config_buffer_parallel(const char* data, size_t size, int* process_count, int thread_count);
+
+// Parses an open config stream line by line, with fgets()
+// Params:
+// @file: The stream to read until EOF (left open)
+// @process_count: Pointer to save the number of parsed processes
+
+// Return:
+// Dynamically-allocated table of parsed processes OTHERWISE NULL
+Process* parse_config_stream(FILE* file, int* process_count);
+
+// An open config file (text or binary) read one process at a time, in file order
+typedef struct ConfigReader ConfigReader;
+
+// Opens a config file for reading process by process
+// Only the process being read is held in memory; binary workloads are mapped
+
+// Return:
+// A reader to release with config_reader_close OTHERWISE NULL
+ConfigReader* config_reader_open(const char* filepath);
+
+// Reads the next process of the file
+// Params:
+// @reader: The open reader
+// @process: The process to fill (original_index counts processes in file order)
+
+// Return:
+// 1 if a process was read, 0 at the end of the file, -1 after printing a parse error
+int config_reader_next(ConfigReader* reader, Process* process);
+
+// Closes a reader (may be NULL)
+void config_reader_close(ConfigReader* reader);
+
 #endif
@@ -0,0 +1,94 @@
+#ifndef WORKLOAD_BINARY_H
+#define WORKLOAD_BINARY_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../data_structures/process.h"
+
+// Binary workload layout (version 1, native byte order, every offset from the file start):
+//   BinaryWorkloadHeader
+//   process_count BinaryProcessRecord, in config order, at records_offset
+//   names_size bytes of NUL-terminated names at names_offset (identical names stored once)
+
+#define BINARY_WORKLOAD_MAGIC "SCHEDWL\0"
+#define BINARY_WORKLOAD_MAGIC_SIZE 8
+#define BINARY_WORKLOAD_VERSION 1
+#define BINARY_WORKLOAD_BYTE_ORDER 0x01020304u
+
+typedef struct {
+    char magic[BINARY_WORKLOAD_MAGIC_SIZE]; // BINARY_WORKLOAD_MAGIC
+    uint32_t version; // BINARY_WORKLOAD_VERSION
+    uint32_t byte_order; // BINARY_WORKLOAD_BYTE_ORDER as written by the producing machine
+    uint64_t process_count;
+    uint64_t records_offset;
+    uint64_t names_offset;
+    uint64_t names_size;
+} BinaryWorkloadHeader;
+
+typedef struct {
+    int32_t arrival_time;
+    int32_t burst_time;
+    int32_t priority;
+    uint32_t name_offset; // Offset of the name inside the names area
+} BinaryProcessRecord;
+
+// Tells if a buffer starts like a binary workload
+// Params:
+// @data: The file contents
+// @size: Their length in bytes
+bool is_binary_workload(const char* data, size_t size);
+
+// Checks the header and section bounds of a binary workload already in memory
+// Params:
+// @data: The file contents (at least 8-byte aligned)
+// @size: Their length in bytes
+
+// Return:
+// The number of process records OTHERWISE -1
+int binary_workload_count(const char* data, size_t size);
+
+// Fills one process from its record, checking its name and fields
+// Params:
+// @data: The file contents, already accepted by binary_workload_count
+// @index: The record to read (0 <= index < count)
+// @process: The process to fill
+
+// Return:
+// true OTHERWISE false
+bool binary_workload_get(const char* data, int index, Process* process);
+
+// Builds the processes of a binary workload already in memory (typically a mapped file)
+// The header, every record and every name are checked; no text is parsed
+// Params:
+// @data: The file contents (at least 8-byte aligned)
+// @size: Their length in bytes
+// @process_count: Pointer to save the number of processes
+
+// Return:
+// Dynamically-allocated table of processes OTHERWISE NULL
+Process* load_binary_workload(const char* data, size_t size, int* process_count);
+
+// Writes processes as a binary workload
+// Params:
+// @filepath: Path of the file to create (replaced if it exists)
+// @processes: The processes, in config order
+// @count: Their number
+
+// Return:
+// 0 on success OTHERWISE -1
+int write_binary_workload(const char* filepath, const Process* processes, int count);
+
+// Writes processes in the text config syntax
+// Params:
+// @file: The stream to write to
+// @processes: The processes, in config order
+// @count: Their number
+
+// Return:
+// 0 on success OTHERWISE -1
+int write_config_text(FILE* file, const Process* processes, int count);
+
+#endif
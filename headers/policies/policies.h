@@ -2,7 +2,14 @@
 #define POLICIES_H
 
 #include <stdbool.h>
+#include <limits.h>
 #include "../data_structures/process.h"
+#include "../engine/policy_interface.h"
+
+/**
+ * @brief Returned by ticks_until_event when the policy has no pending timer.
+ */
+#define POLICY_NO_EVENT INT_MAX
 
 // Forward declaration of the opaque Policy handle
 typedef struct Policy Policy;
@@ -10,7 +17,7 @@ typedef struct Policy Policy;
 // The VTable structure for a policy, containing all function pointers.
 typedef struct PolicyVTable {
     const char* name;
-    void* (*create)(int quantum);
+    void* (*create)(const PolicyOptions* options);
     void (*destroy)(void* policy_data);
     void (*add_process)(void* policy_data, Process* process);
     Process* (*get_next_process)(void* policy_data);
@@ -18,24 +25,35 @@ typedef struct PolicyVTable {
     bool (*needs_reschedule)(void* policy_data, Process* running_process);
     int (*get_quantum)(void* policy_data, Process* process);
     void (*demote_process)(void* policy_data, Process* process);
+
+    // Event-driven engine support:
+    // ticks_until_event returns how many upcoming executed ticks are guaranteed to leave
+    // needs_reschedule unchanged and make tick() a pure clock advance (POLICY_NO_EVENT if none).
+    // advance moves the policy's clock forward by that many ticks without a per-tick call.
+    // Policies without timers leave tick, ticks_until_event and advance NULL.
+    int (*ticks_until_event)(void* policy_data, Process* running_process);
+    void (*advance)(void* policy_data, int ticks);
 } PolicyVTable;
 
 /**
  * @brief Registers a policy's vtable with the central registrar.
+ *        Thread-safe; a name that is already registered is ignored.
  * @param vtable A pointer to the policy's static vtable.
  */
 void register_policy(const PolicyVTable* vtable);
 
 /**
  * @brief Retrieves the names of all currently registered policies.
+ *        The built-in policies are registered on first use.
  * @param count A pointer to an integer that will be filled with the number of policies.
- * @return An array of strings containing the policy names.
+ * @return An array of strings containing the policy names, valid until the next new registration.
  */
 const char** get_available_policies(int* count);
 
 /**
  * @brief Calls the registration function for every available policy.
  *        This function must be implemented to call register_policy for each policy's vtable.
+ *        Runs the registration once per process; repeated or concurrent calls are safe.
  */
 void register_all_policies();
 
@@ -81,6 +81,86 @@ bool get_policy_input(char** policy_input) {
     return true;
 }
 
+/**
+ * @brief Splits a comma-separated list in place.
+ *
+ * @param list The list to split; its commas are replaced by string terminators.
+ * @param items Pointer set to a dynamically allocated array of pointers into list
+ *              (to be freed by the caller). Empty items are skipped.
+ * @return The number of items, or -1 on allocation failure.
+ */
+int split_comma_list(char* list, char*** items) {
+    int capacity = 1;
+    for (const char* c = list; *c; c++) {
+        if (*c == ',') capacity++;
+    }
+
+    *items = (char**)malloc(capacity * sizeof(char*));
+    if (!*items) {
+        perror("CLI Error: Could not allocate list");
+        return -1;
+    }
+
+    int count = 0;
+    char* item = list;
+    while (item) {
+        char* comma = strchr(item, ',');
+        if (comma) *comma = '\0';
+        if (*item) (*items)[count++] = item;
+        item = comma ? comma + 1 : NULL;
+    }
+    return count;
+}
+
+/**
+ * @brief Parses a comma-separated list of positive integers (an MLFQ per-level table).
+ *
+ * @param list The list to parse (split in place).
+ * @param option The option name, for error messages.
+ * @param values Pointer set to a dynamically allocated array of values.
+ * @return The number of values, or -1 on error.
+ */
+static int parse_level_table(char* list, const char* option, int** values) {
+    char** items = NULL;
+    int count = split_comma_list(list, &items);
+    if (count < 0) return -1;
+    if (count == 0 || count > MLFQ_MAX_LEVELS) {
+        fprintf(stderr, "Error: %s needs between 1 and %d values.\n", option, MLFQ_MAX_LEVELS);
+        free(items);
+        return -1;
+    }
+
+    *values = (int*)malloc(count * sizeof(int));
+    if (!*values) {
+        perror("CLI Error: Could not allocate list");
+        free(items);
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        (*values)[i] = atoi(items[i]);
+        if ((*values)[i] <= 0) {
+            fprintf(stderr, "Error: Invalid %s value '%s'. Must be a positive integer.\n", option, items[i]);
+            free(*values);
+            *values = NULL;
+            free(items);
+            return -1;
+        }
+    }
+    free(items);
+    return count;
+}
+
+/**
+ * @brief Frees the memory parse_arguments allocated inside a CLIParams structure.
+ * @param params The parsed parameters.
+ */
+void free_cli_params(CLIParams* params) {
+    free((int*)params->mlfq.quanta);
+    free((int*)params->mlfq.allotments);
+    params->mlfq.quanta = NULL;
+    params->mlfq.allotments = NULL;
+}
+
 /**
  * @brief Displays usage information for the program.
  * @param prog_name The name of the program (argv[0]).
@@ -98,11 +178,54 @@ void print_usage(const char* prog_name) {
     printf("\n");
     printf("Optional Arguments:\n");
     printf("  --verbose            Enable verbose output with detailed logs\n");
+    printf("  --tick-engine        Simulate every time unit (reference engine, slower)\n");
+    printf("  --cpus N             Number of CPUs sharing the ready queue (default: 1)\n");
+    printf("  --per-cpu-queues     Give each CPU its own run queue; idle CPUs steal work\n");
+    printf("  --balance-interval N Ticks between steal attempts, 0 disables stealing (default: 1)\n");
+    printf("  --migration-cost N   Ticks a CPU stalls before running a stolen process (default: 0)\n");
+    printf("  --stream             Read processes as they arrive instead of loading the config\n");
+    printf("                       (the config must be sorted by arrival_time; no Gantt chart)\n");
+    printf("  --results FILE       Write each finished process and Gantt segment to FILE as it completes:\n");
+    printf("                       CSV if FILE ends in .csv, binary records otherwise\n");
+    printf("  --telemetry FILE     Write ready-queue length, arrived/in-system counts and CPU states\n");
+    printf("                       over time to FILE (CSV)\n");
+    printf("  --telemetry-stride N Ticks between two telemetry samples (default: 1)\n");
+    printf("  --log FILE           Write scheduling events to FILE as binary records instead of printing them\n");
+    printf("  --log-level LEVEL    Lowest event level logged: debug, info, warn, error (default: debug)\n");
+    printf("  --log-categories LIST  Events logged: arrival, dispatch, preemption, termination,\n");
+    printf("                       migration, or all (default: all)\n");
+    printf("  --decode-log FILE    Print a binary log as text and exit\n");
+    printf("  --profile            Print parse/simulate/render times, ticks/sec and decisions/sec\n");
+    printf("                       (per-phase timings and policy call counts need make PROFILE=1)\n");
     printf("  -h, --help           Display this help message and exit\n");
     printf("\n");
+    printf("Sweep Mode (non-interactive):\n");
+    printf("  --policies LIST      Comma-separated policies to run, or 'all'\n");
+    printf("  --configs LIST       Comma-separated config files (in addition to -c)\n");
+    printf("  --quanta LIST        Comma-separated quanta for rr/mlfq (default: 2)\n");
+    printf("  -j, --jobs N         Worker threads (default: one per online CPU); outside sweeps,\n");
+    printf("                       threads reducing the final metrics of very large runs\n");
+    printf("\n");
+    printf("MLFQ Tuning (per-level lists start at the top level; the last value repeats):\n");
+    printf("  --mlfq-levels N      Number of priority levels (default: 20)\n");
+    printf("  --mlfq-quanta LIST   Quantum of each level (default: 1x to 4x the quantum)\n");
+    printf("  --mlfq-allotments LIST  Ticks allowed at each level before demotion (default: 5x quantum)\n");
+    printf("  --mlfq-aging N|off   Waiting ticks before a promotion (default: 10)\n");
+    printf("  --mlfq-boost N       Move every process to the top level every N ticks (default: never)\n");
+    printf("\n");
+    printf("Workload Conversion:\n");
+    printf("  --convert FILE       Write the config (text or binary) to FILE and exit:\n");
+    printf("                       text if FILE ends in .conf, binary workload otherwise\n");
+    printf("\n");
     printf("Examples:\n");
     printf("  %s -c configs/test1.conf\n", prog_name);
     printf("  %s --config configs/test1.conf --verbose\n", prog_name);
+    printf("  %s -c configs/test2.conf --cpus 4\n", prog_name);
+    printf("  %s -c configs/test2.conf --cpus 4 --per-cpu-queues --migration-cost 2\n", prog_name);
+    printf("  %s --configs configs/test1.conf,configs/test2.conf --policies all --quanta 1,2,4\n", prog_name);
+    printf("  %s -c configs/mlfq_test.conf --mlfq-levels 3 --mlfq-quanta 2,4,8 --mlfq-boost 50\n", prog_name);
+    printf("  %s -c configs/test2.conf --convert test2.wlb\n", prog_name);
+    printf("  %s -c test2.wlb --stream --results test2.csv\n", prog_name);
     printf("\n");
     printf("After starting, you will be prompted to select a scheduling policy\n");
     printf("from the available options discovered in your installation.\n");
@@ -115,18 +238,65 @@ void print_usage(const char* prog_name) {
  *
  * @param argc Argument count from main.
  * @param argv Argument vector from main.
- * @param params Pointer to CLIParams structure to populate.
+ * @param params Pointer to CLIParams structure to populate. Release it with
+ *               free_cli_params, whatever the return value.
  * @return 0 on success, -1 on error or if help was displayed.
  */
 int parse_arguments(int argc, char* argv[], CLIParams* params) {
     // Initializing parameters (default values)
     params->config_filepath = NULL;
     params->verbose = false;
+    params->tick_engine = false;
+    params->cpu_count = 1;
+    params->per_cpu_queues = false;
+    params->balance_interval = 1;
+    params->migration_cost = 0;
+    params->sweep = false;
+    params->sweep_configs = NULL;
+    params->sweep_policies = NULL;
+    params->sweep_quanta = NULL;
+    params->jobs = 0;
+    params->mlfq_custom = false;
+    memset(&params->mlfq, 0, sizeof(params->mlfq));
+    params->convert_output = NULL;
+    params->stream = false;
+    params->results_output = NULL;
+    params->telemetry_output = NULL;
+    params->telemetry_stride = 1;
+    params->log_output = NULL;
+    params->log_level = LOG_LEVEL_DEBUG;
+    params->log_categories = LOG_CATEGORY_ALL;
+    params->decode_log = NULL;
+    params->profile = false;
 
     // Defining long options for getopt_long
     const struct option long_options[] = {
         {"config",  required_argument, 0, 'c'},
         {"verbose", no_argument,       0, 'v'},
+        {"tick-engine", no_argument,   0, 't'},
+        {"cpus",    required_argument, 0, 'n'},
+        {"per-cpu-queues", no_argument, 0, 'q'},
+        {"balance-interval", required_argument, 0, 'b'},
+        {"migration-cost", required_argument, 0, 'm'},
+        {"policies", required_argument, 0, 'P'},
+        {"configs", required_argument,  0, 'C'},
+        {"quanta",  required_argument,  0, 'Q'},
+        {"jobs",    required_argument,  0, 'j'},
+        {"mlfq-levels", required_argument, 0, 'L'},
+        {"mlfq-quanta", required_argument, 0, 'U'},
+        {"mlfq-allotments", required_argument, 0, 'A'},
+        {"mlfq-aging", required_argument, 0, 'G'},
+        {"mlfq-boost", required_argument, 0, 'B'},
+        {"convert", required_argument, 0, 'X'},
+        {"stream",  no_argument,       0, 'S'},
+        {"results", required_argument, 0, 'R'},
+        {"telemetry", required_argument, 0, 'T'},
+        {"telemetry-stride", required_argument, 0, 'D'},
+        {"log",     required_argument, 0, 'O'},
+        {"log-level", required_argument, 0, 'E'},
+        {"log-categories", required_argument, 0, 'K'},
+        {"decode-log", required_argument, 0, 'Y'},
+        {"profile", no_argument,       0, 'F'},
         {"help",    no_argument,       0, 'h'},
         {0, 0, 0, 0}
     };
@@ -135,7 +305,7 @@ int parse_arguments(int argc, char* argv[], CLIParams* params) {
     int option_index = 0;
 
     // Parsing command-line options
-    while ((opt = getopt_long(argc, argv, "c:vh", long_options, &option_index)) != -1) {
+    while ((opt = getopt_long(argc, argv, "c:vhj:", long_options, &option_index)) != -1) {
         switch (opt) {
             case 'c':
                 params->config_filepath = optarg;
@@ -144,7 +314,164 @@ int parse_arguments(int argc, char* argv[], CLIParams* params) {
             case 'v':
                 params->verbose = true;
                 break;
+
+            case 't':
+                params->tick_engine = true;
+                break;
+
+            case 'n':
+                params->cpu_count = atoi(optarg);
+                if (params->cpu_count <= 0) {
+                    fprintf(stderr, "Error: --cpus must be a positive integer.\n");
+                    return -1;
+                }
+                break;
+
+            case 'q':
+                params->per_cpu_queues = true;
+                break;
+
+            case 'b':
+                params->balance_interval = atoi(optarg);
+                if (params->balance_interval < 0) {
+                    fprintf(stderr, "Error: --balance-interval must not be negative.\n");
+                    return -1;
+                }
+                break;
+
+            case 'm':
+                params->migration_cost = atoi(optarg);
+                if (params->migration_cost < 0) {
+                    fprintf(stderr, "Error: --migration-cost must not be negative.\n");
+                    return -1;
+                }
+                break;
+
+            case 'P':
+                params->sweep = true;
+                params->sweep_policies = optarg;
+                break;
+
+            case 'C':
+                params->sweep_configs = optarg;
+                break;
+
+            case 'Q':
+                params->sweep_quanta = optarg;
+                break;
+
+            case 'j':
+                params->jobs = atoi(optarg);
+                if (params->jobs <= 0) {
+                    fprintf(stderr, "Error: --jobs must be a positive integer.\n");
+                    return -1;
+                }
+                break;
             
+            case 'L':
+                params->mlfq_custom = true;
+                params->mlfq.level_count = atoi(optarg);
+                if (params->mlfq.level_count <= 0 || params->mlfq.level_count > MLFQ_MAX_LEVELS) {
+                    fprintf(stderr, "Error: --mlfq-levels must be between 1 and %d.\n", MLFQ_MAX_LEVELS);
+                    return -1;
+                }
+                break;
+
+            case 'U': {
+                params->mlfq_custom = true;
+                int* quanta = NULL;
+                free((int*)params->mlfq.quanta);
+                params->mlfq.quanta = NULL;
+                params->mlfq.quanta_count = parse_level_table(optarg, "--mlfq-quanta", &quanta);
+                if (params->mlfq.quanta_count < 0) {
+                    return -1;
+                }
+                params->mlfq.quanta = quanta;
+                break;
+            }
+
+            case 'A': {
+                params->mlfq_custom = true;
+                int* allotments = NULL;
+                free((int*)params->mlfq.allotments);
+                params->mlfq.allotments = NULL;
+                params->mlfq.allotment_count = parse_level_table(optarg, "--mlfq-allotments", &allotments);
+                if (params->mlfq.allotment_count < 0) {
+                    return -1;
+                }
+                params->mlfq.allotments = allotments;
+                break;
+            }
+
+            case 'G':
+                params->mlfq_custom = true;
+                // MlfqParameters: negative disables aging, 0 keeps the default
+                params->mlfq.aging_threshold = (strcmp(optarg, "off") == 0) ? -1 : atoi(optarg);
+                if (params->mlfq.aging_threshold == 0 || params->mlfq.aging_threshold < -1) {
+                    fprintf(stderr, "Error: --mlfq-aging must be a positive integer or 'off'.\n");
+                    return -1;
+                }
+                break;
+
+            case 'B':
+                params->mlfq_custom = true;
+                params->mlfq.boost_period = atoi(optarg);
+                if (params->mlfq.boost_period < 0) {
+                    fprintf(stderr, "Error: --mlfq-boost must not be negative.\n");
+                    return -1;
+                }
+                break;
+
+            case 'X':
+                params->convert_output = optarg;
+                break;
+
+            case 'S':
+                params->stream = true;
+                break;
+
+            case 'R':
+                params->results_output = optarg;
+                break;
+
+            case 'T':
+                params->telemetry_output = optarg;
+                break;
+
+            case 'D':
+                params->telemetry_stride = atoi(optarg);
+                if (params->telemetry_stride <= 0) {
+                    fprintf(stderr, "Error: --telemetry-stride must be a positive integer.\n");
+                    return -1;
+                }
+                break;
+
+            case 'O':
+                params->log_output = optarg;
+                break;
+
+            case 'E':
+                if (!log_level_parse(optarg, &params->log_level)) {
+                    fprintf(stderr, "Error: --log-level must be debug, info, warn or error.\n");
+                    return -1;
+                }
+                break;
+
+            case 'K':
+                if (!log_categories_parse(optarg, &params->log_categories)) {
+                    fprintf(stderr, "Error: --log-categories takes arrival, dispatch, preemption, termination, migration or all.\n");
+                    return -1;
+                }
+                break;
+
+            case 'Y':
+                params->decode_log = optarg;
+                break;
+
+            case 'F':
+                params->profile = true;
+                break;
+
             case 'h':
                 print_usage(argv[0]);
                 return -1;
@@ -160,6 +487,20 @@ int parse_arguments(int argc, char* argv[], CLIParams* params) {
         }
     }
 
+    // Decoding a log needs no config
+    if (params->decode_log) {
+        return 0;
+    }
+
+    // A sweep may take its configs from --configs alone
+    if (params->sweep && !params->config_filepath && params->sweep_configs) {
+        return 0;
+    }
+    if ((params->sweep_configs || params->sweep_quanta) && !params->sweep) {
+        fprintf(stderr, "Error: --configs and --quanta need --policies (sweep mode).\n");
+        return -1;
+    }
+
     // Validating the required argument (config filepath)
     if (!params->config_filepath) {
         fprintf(stderr, "Error: Configuration file is required.\n");
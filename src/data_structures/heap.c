@@ -0,0 +1,208 @@
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../../headers/data_structures/data_structures.h"
+
+#define INITIAL_CAPACITY 16
+
+// Children of node i are ARITY*i + 1 ... ARITY*i + ARITY; four keys share a cache line.
+// The built-in keys are total orders, so the arity never changes which process pops next
+#define ARITY 4
+
+struct Heap {
+    Process** data;
+    int size;
+    int capacity;
+    HeapKey key;
+    Comparator comp;    // Only used with HEAP_KEY_CUSTOM
+};
+
+
+// --- Orderings: each returns true if a must come out of the heap before b ---
+
+// Common tail of every built-in key: earlier arrival, then lower process id
+static inline bool fcfs_before(const Process* a, const Process* b) {
+    if (a->arrival_time != b->arrival_time) return a->arrival_time < b->arrival_time;
+    return a->original_index < b->original_index;
+}
+
+static inline bool burst_before(const Process* a, const Process* b) {
+    if (a->burst_time != b->burst_time) return a->burst_time < b->burst_time;
+    return fcfs_before(a, b);
+}
+
+static inline bool remaining_before(const Process* a, const Process* b) {
+    if (a->remaining_burst_time != b->remaining_burst_time) return a->remaining_burst_time < b->remaining_burst_time;
+    if (a->last_executed_time != b->last_executed_time) return a->last_executed_time < b->last_executed_time;
+    return fcfs_before(a, b);
+}
+
+static inline bool priority_before(const Process* a, const Process* b) {
+    if (a->priority != b->priority) return a->priority > b->priority;
+    return fcfs_before(a, b);
+}
+
+static inline bool priority_recency_before(const Process* a, const Process* b) {
+    if (a->priority != b->priority) return a->priority > b->priority;
+    if (a->last_executed_time != b->last_executed_time) return a->last_executed_time < b->last_executed_time;
+    return fcfs_before(a, b);
+}
+
+
+// --- Sifts: one copy per ordering so the comparison is inlined ---
+// Both move a "hole" instead of swapping: entries shift one level and the
+// moving process is written once, at its final slot.
+
+#define DEFINE_SIFTS(NAME, BEFORE)                                              \
+static void sift_up_##NAME(const Heap* h, int index, Process* p) {             \
+    Process** data = h->data;                                                   \
+    while (index > 0) {                                                         \
+        int parent = (index - 1) / ARITY;                                       \
+        if (!BEFORE(p, data[parent])) break;                                    \
+        data[index] = data[parent];                                             \
+        index = parent;                                                         \
+    }                                                                           \
+    data[index] = p;                                                            \
+}                                                                               \
+static void sift_down_##NAME(const Heap* h, int index, Process* p) {           \
+    Process** data = h->data;                                                   \
+    int size = h->size;                                                         \
+    for (;;) {                                                                  \
+        int first = ARITY * index + 1;                                          \
+        if (first >= size) break;                                               \
+        int last = first + ARITY < size ? first + ARITY : size;                 \
+        int best = first;                                                       \
+        for (int child = first + 1; child < last; child++) {                    \
+            if (BEFORE(data[child], data[best])) best = child;                  \
+        }                                                                       \
+        if (!BEFORE(data[best], p)) break;                                      \
+        data[index] = data[best];                                               \
+        index = best;                                                           \
+    }                                                                           \
+    data[index] = p;                                                            \
+}
+
+#define CUSTOM_BEFORE(a, b) (h->comp((a), (b)) < 0)
+#define BURST_BEFORE(a, b) burst_before((a), (b))
+#define REMAINING_BEFORE(a, b) remaining_before((a), (b))
+#define PRIORITY_BEFORE(a, b) priority_before((a), (b))
+#define PRIORITY_RECENCY_BEFORE(a, b) priority_recency_before((a), (b))
+
+DEFINE_SIFTS(custom, CUSTOM_BEFORE)
+DEFINE_SIFTS(burst, BURST_BEFORE)
+DEFINE_SIFTS(remaining, REMAINING_BEFORE)
+DEFINE_SIFTS(priority, PRIORITY_BEFORE)
+DEFINE_SIFTS(priority_recency, PRIORITY_RECENCY_BEFORE)
+
+// Places p at the hole at index, moving it towards the root
+static void sift_up(const Heap* h, int index, Process* p) {
+    switch (h->key) {
+        case HEAP_KEY_BURST: sift_up_burst(h, index, p); break;
+        case HEAP_KEY_REMAINING: sift_up_remaining(h, index, p); break;
+        case HEAP_KEY_PRIORITY: sift_up_priority(h, index, p); break;
+        case HEAP_KEY_PRIORITY_RECENCY: sift_up_priority_recency(h, index, p); break;
+        default: sift_up_custom(h, index, p); break;
+    }
+}
+
+// Places p at the hole at index, moving it towards the leaves
+static void sift_down(const Heap* h, int index, Process* p) {
+    switch (h->key) {
+        case HEAP_KEY_BURST: sift_down_burst(h, index, p); break;
+        case HEAP_KEY_REMAINING: sift_down_remaining(h, index, p); break;
+        case HEAP_KEY_PRIORITY: sift_down_priority(h, index, p); break;
+        case HEAP_KEY_PRIORITY_RECENCY: sift_down_priority_recency(h, index, p); break;
+        default: sift_down_custom(h, index, p); break;
+    }
+}
+
+
+// Helper function to resize the heap
+static bool heap_resize(Heap* h) {
+    int new_capacity = h->capacity * 2;
+    Process** new_data = realloc(h->data, new_capacity * sizeof(Process*));
+    if (!new_data) return false;
+
+    h->data = new_data;
+    h->capacity = new_capacity;
+    return true;
+}
+
+static Heap* heap_alloc(HeapKey key, Comparator comp) {
+    Heap* h = (Heap*) malloc(sizeof(Heap));
+    if (!h) return NULL;
+
+    h->data = (Process**) malloc(INITIAL_CAPACITY * sizeof(Process*));
+    if (!h->data) {
+        free(h);
+        return NULL;
+    }
+
+    h->size = 0;
+    h->capacity = INITIAL_CAPACITY;
+    h->key = key;
+    h->comp = comp;
+
+    return h;
+}
+
+// Creating a heap ordered by a custom comparator : Returns a pointer to an empty heap
+Heap* heap_create(Comparator comp) {
+    if (!comp) return NULL;
+    return heap_alloc(HEAP_KEY_CUSTOM, comp);
+}
+
+// Creating a heap ordered by a built-in key : Returns a pointer to an empty heap
+Heap* heap_create_keyed(HeapKey key) {
+    if (key == HEAP_KEY_CUSTOM) return NULL;
+    return heap_alloc(key, NULL);
+}
+
+// Adding a process to the heap
+void heap_push(Heap* h, Process* p) {
+    if (h->size == h->capacity && !heap_resize(h)) return;
+
+    h->size++;
+    sift_up(h, h->size - 1, p);
+}
+
+// Pulling the first process from the heap (By removing it)
+Process* heap_pop(Heap* h) {
+    if (h->size == 0) return NULL;
+
+    Process* root = h->data[0];
+
+    // The last element fills the hole left at the root
+    h->size--;
+    if (h->size > 0) {
+        sift_down(h, 0, h->data[h->size]);
+    }
+
+    return root;
+}
+
+// Peeking at the first process of the heap (Without removing it)
+Process* heap_peek(const Heap* h) {
+    if (h->size == 0) return NULL;
+    return h->data[0];
+}
+
+// Verifying if a heap is empty
+bool heap_is_empty(const Heap* h) {
+    return (h->size == 0);
+}
+
+// Getting the number of elements in the heap
+int heap_size(const Heap* h) {
+    return h ? h->size : 0;
+}
+
+// Freeing all the memory used by the heap;
+void heap_destroy(Heap* h) {
+    if (h) {
+        if (h->data) {
+            free(h->data);
+        }
+        free(h);
+    }
+}
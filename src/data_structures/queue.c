@@ -1,18 +1,19 @@
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 
 #include "../../headers/data_structures/data_structures.h"
 
-struct QueueNode {
-    Process* process;
-    struct QueueNode* next;
-};
+// Initial number of slots; the capacity is always a power of two
+#define QUEUE_INITIAL_CAPACITY 16
 
 
+// Ring buffer: the live elements are items[start], items[start + 1], ... (modulo capacity)
 struct Queue {
-    QueueNode* start;
-    QueueNode* end;
+    Process** items;
+    int start;
     int size;
+    int capacity;
 };
 
 
@@ -22,30 +23,44 @@ Queue* queue_create() {
 
     if (!q) return NULL;
 
-    q->start = NULL;
-    q->end = NULL;
+    q->items = (Process**) malloc(QUEUE_INITIAL_CAPACITY * sizeof(Process*));
+    if (!q->items) {
+        free(q);
+        return NULL;
+    }
+
+    q->start = 0;
     q->size = 0;
+    q->capacity = QUEUE_INITIAL_CAPACITY;
 
     return q;
 }
 
 
+// Doubling the capacity, unwrapping the elements to the front of the new buffer
+static bool queue_grow(Queue* q) {
+    int new_capacity = q->capacity * 2;
+    Process** items = (Process**) malloc(new_capacity * sizeof(Process*));
+    if (!items) return false;
+
+    int first_part = q->capacity - q->start;
+    if (first_part > q->size) first_part = q->size;
+    memcpy(items, q->items + q->start, first_part * sizeof(Process*));
+    memcpy(items + first_part, q->items, (q->size - first_part) * sizeof(Process*));
+
+    free(q->items);
+    q->items = items;
+    q->start = 0;
+    q->capacity = new_capacity;
+    return true;
+}
+
+
 // Inserting a process at the end of the queue
 void queue_enqueue(Queue* q, Process* p) {
-    QueueNode* node = (QueueNode*) malloc(sizeof(QueueNode));
-    if (!node) return;
-
-    node->process = p;
-    node->next = NULL;
-
-    if (q->size == 0) {
-        q->start = node;
-        q->end = node;
-    } else {
-        q->end->next = node;
-        q->end = node;
-    }
+    if (q->size == q->capacity && !queue_grow(q)) return;
 
+    q->items[(q->start + q->size) & (q->capacity - 1)] = p;
     q->size++;
 
     return;
@@ -54,27 +69,20 @@ void queue_enqueue(Queue* q, Process* p) {
 
 // Pulling a process from the start of the queue (By removing it)
 Process* queue_dequeue(Queue* q) {
-    if (!q->start) return NULL;
+    if (q->size == 0) return NULL;
 
-    QueueNode* node = q->start;
-    q->start = q->start->next;
-    
-    if (q->start == NULL) {
-        q->end = NULL;
-    }
-    
+    Process* p = q->items[q->start];
+    q->start = (q->start + 1) & (q->capacity - 1);
     q->size--;
 
-    Process* p = node->process;
-    free(node);
     return p;
 }
 
 
 // Peeking at the process that is at the top of the queue (Without removing it)
 Process* queue_peek(const Queue* q) {
-    if (!q->start) return NULL;
-    return q->start->process;
+    if (q->size == 0) return NULL;
+    return q->items[q->start];
 }
 
 
@@ -90,9 +98,8 @@ int queue_size(const Queue* q) {
 
 // Freeing all the memory used by the queue;
 void queue_destroy(Queue* q) {
-    while (!queue_is_empty(q)) {
-        queue_dequeue(q);
-    }
+    if (!q) return;
 
+    free(q->items);
     free(q);
-}
\ No newline at end of file
+}
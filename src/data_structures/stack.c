@@ -3,15 +3,15 @@
 
 #include "../../headers/data_structures/data_structures.h"
 
-struct StackNode {
-    Process* process;
-    struct StackNode* next;
-};
+// Initial number of slots; the array doubles when it fills up
+#define STACK_INITIAL_CAPACITY 16
 
 
+// Growable array: items[size - 1] is the top of the stack
 struct Stack {
-    StackNode* top;
+    Process** items;
     int size;
+    int capacity;
 };
 
 
@@ -21,8 +21,14 @@ Stack* stack_create() {
 
     if (!s) return NULL;
 
-    s->top = NULL;
+    s->items = (Process**) malloc(STACK_INITIAL_CAPACITY * sizeof(Process*));
+    if (!s->items) {
+        free(s);
+        return NULL;
+    }
+
     s->size = 0;
+    s->capacity = STACK_INITIAL_CAPACITY;
 
     return s;
 }
@@ -30,35 +36,29 @@ Stack* stack_create() {
 
 // Inserting a process at the top of the stack
 void stack_push(Stack* s, Process* p) {
-    StackNode* node = (StackNode*) malloc(sizeof(StackNode));
-    if (!node) return;
-
-    node->process = p;
-    node->next = s->top;
-    s->top = node;
+    if (s->size == s->capacity) {
+        Process** items = (Process**) realloc(s->items, s->capacity * 2 * sizeof(Process*));
+        if (!items) return;
+        s->items = items;
+        s->capacity *= 2;
+    }
 
-    s->size++;
+    s->items[s->size++] = p;
 
     return;
 }
 
 // Pulling a process from the top of the stack (By removing it)
 Process* stack_pop(Stack* s) {
-    if (!s->top) return NULL;
-
-    StackNode* node = s->top;
-    s->top = s->top->next;
-    s->size--;
+    if (s->size == 0) return NULL;
 
-    Process* p = node->process;
-    free(node);
-    return p;
+    return s->items[--s->size];
 }
 
 // Peeking at the process that is at the top of the stack (Without removing it)
 Process* stack_peek(const Stack* s) {
-    if (!s->top) return NULL;
-    return s->top->process;
+    if (s->size == 0) return NULL;
+    return s->items[s->size - 1];
 }
 
 // Verifying if a stack is empty
@@ -68,9 +68,8 @@ bool stack_is_empty(const Stack* s) {
 
 // Freeing all the memory used by the stack;
 void stack_destroy(Stack* s) {
-    while (!stack_is_empty(s)) {
-        stack_pop(s);
-    }
+    if (!s) return;
 
+    free(s->items);
     free(s);
-}
\ No newline at end of file
+}
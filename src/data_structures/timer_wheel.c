@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "../../headers/data_structures/timer_wheel.h"
+
+#define SLOT_BITS 6
+#define SLOTS (1 << SLOT_BITS)
+#define LEVELS 6
+
+// Invariant: a timer at level k has the same digits as the clock above digit k,
+// and its digit k is at or after the clock's; level 0 timers differ only in digit 0.
+struct TimerWheel {
+    long long now;
+    int size;
+    uint64_t occupied[LEVELS];          // Bit s of occupied[k] is set while slots[k][s] holds a timer
+    TimerNode* slots[LEVELS][SLOTS];
+};
+
+
+// Level a timer belongs to: the highest digit where its expiry and the clock differ
+static inline int level_for(long long now, long long expires) {
+    uint64_t diff = (uint64_t)(expires ^ now);
+    if (diff < SLOTS) return 0;
+    int level = (63 - __builtin_clzll(diff)) / SLOT_BITS;
+    return (level < LEVELS) ? level : LEVELS - 1;
+}
+
+static inline int slot_for(long long expires, int level) {
+    return (int)((uint64_t)expires >> (level * SLOT_BITS)) & (SLOTS - 1);
+}
+
+static void link_timer(TimerWheel* wheel, TimerNode* timer) {
+    int level = level_for(wheel->now, timer->expires);
+    int slot = slot_for(timer->expires, level);
+    timer->level = level;
+    timer->slot = slot;
+    timer->prev = NULL;
+    timer->next = wheel->slots[level][slot];
+    if (timer->next) timer->next->prev = timer;
+    wheel->slots[level][slot] = timer;
+    wheel->occupied[level] |= UINT64_C(1) << slot;
+}
+
+static void unlink_timer(TimerWheel* wheel, TimerNode* timer) {
+    if (timer->prev) timer->prev->next = timer->next;
+    else wheel->slots[timer->level][timer->slot] = timer->next;
+    if (timer->next) timer->next->prev = timer->prev;
+    if (!wheel->slots[timer->level][timer->slot]) {
+        wheel->occupied[timer->level] &= ~(UINT64_C(1) << timer->slot);
+    }
+    timer->level = -1;
+    timer->next = timer->prev = NULL;
+}
+
+
+TimerWheel* timer_wheel_create(long long now) {
+    TimerWheel* wheel = (TimerWheel*)calloc(1, sizeof(TimerWheel));
+    if (!wheel) return NULL;
+    wheel->now = now;
+    return wheel;
+}
+
+void timer_init(TimerNode* timer) {
+    timer->expires = 0;
+    timer->next = timer->prev = NULL;
+    timer->level = -1;
+    timer->slot = 0;
+}
+
+bool timer_is_armed(const TimerNode* timer) {
+    return timer->level >= 0;
+}
+
+void timer_wheel_arm(TimerWheel* wheel, TimerNode* timer, long long expires) {
+    if (timer_is_armed(timer)) {
+        if (timer->expires == expires) return;
+        unlink_timer(wheel, timer);
+        wheel->size--;
+    }
+    timer->expires = (expires < wheel->now) ? wheel->now : expires;
+    link_timer(wheel, timer);
+    wheel->size++;
+}
+
+void timer_wheel_cancel(TimerWheel* wheel, TimerNode* timer) {
+    if (!timer_is_armed(timer)) return;
+    unlink_timer(wheel, timer);
+    wheel->size--;
+}
+
+long long timer_wheel_next_expiry(const TimerWheel* wheel) {
+    // Lower levels always expire first; within level 0 the slot gives the exact time
+    for (int level = 0; level < LEVELS; level++) {
+        if (!wheel->occupied[level]) continue;
+        int slot = __builtin_ctzll(wheel->occupied[level]);
+        if (level == 0) return (wheel->now & ~(long long)(SLOTS - 1)) | slot;
+
+        long long earliest = wheel->slots[level][slot]->expires;
+        for (const TimerNode* timer = wheel->slots[level][slot]->next; timer; timer = timer->next) {
+            if (timer->expires < earliest) earliest = timer->expires;
+        }
+        return earliest;
+    }
+    return TIMER_WHEEL_NEVER;
+}
+
+void timer_wheel_advance(TimerWheel* wheel, long long now) {
+    if (now <= wheel->now) return;
+    wheel->now = now;
+
+    // Only the slot holding the new clock can break the invariant at each level;
+    // its timers move down, highest level first so they keep cascading if needed
+    for (int level = LEVELS - 1; level > 0; level--) {
+        int slot = slot_for(now, level);
+        TimerNode* timer = wheel->slots[level][slot];
+        if (!timer) continue;
+        wheel->slots[level][slot] = NULL;
+        wheel->occupied[level] &= ~(UINT64_C(1) << slot);
+        while (timer) {
+            TimerNode* next = timer->next;
+            link_timer(wheel, timer);
+            timer = next;
+        }
+    }
+}
+
+TimerNode* timer_wheel_pop_expired(TimerWheel* wheel) {
+    TimerNode* timer = wheel->slots[0][slot_for(wheel->now, 0)];
+    if (!timer) return NULL;
+    unlink_timer(wheel, timer);
+    wheel->size--;
+    return timer;
+}
+
+int timer_wheel_size(const TimerWheel* wheel) {
+    return wheel->size;
+}
+
+void timer_wheel_destroy(TimerWheel* wheel) {
+    free(wheel);
+}
@@ -0,0 +1,253 @@
+#include "../../headers/engine/metrics.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+
+// Values reduced by one call of the kernel: short enough for its partial sums to stay exact
+#define METRIC_BLOCK 4096
+
+// Smallest share of a column worth handing to a thread of its own
+#define METRIC_PARALLEL_MIN_PER_THREAD (1 << 20)
+
+
+/**
+ * @brief A slice of a column reduced by one thread of metric_add_column.
+ */
+typedef struct {
+    const int* column;
+    size_t count;
+    MetricAccumulator partial;
+} MetricSlice;
+
+
+void metric_init(MetricAccumulator* accumulator) {
+    accumulator->count = 0;
+    accumulator->sum = 0;
+    accumulator->min = 0;
+    accumulator->max = 0;
+    accumulator->m2 = 0;
+}
+
+void metric_add(MetricAccumulator* accumulator, int value) {
+    if (accumulator->count == 0) {
+        accumulator->min = value;
+        accumulator->max = value;
+    } else {
+        if (value < accumulator->min) accumulator->min = value;
+        if (value > accumulator->max) accumulator->max = value;
+    }
+    double old_mean = (accumulator->count > 0) ? (double)accumulator->sum / accumulator->count : 0;
+    accumulator->count++;
+    accumulator->sum += value;
+    double new_mean = (double)accumulator->sum / accumulator->count;
+    accumulator->m2 += (value - old_mean) * (value - new_mean);
+}
+
+void metric_merge(MetricAccumulator* accumulator, const MetricAccumulator* other) {
+    if (other->count == 0) return;
+    if (accumulator->count == 0) {
+        *accumulator = *other;
+        return;
+    }
+
+    // Chan et al.: the spread between the two means adds to the squared deviations
+    double delta = (double)other->sum / other->count - (double)accumulator->sum / accumulator->count;
+    long long count = accumulator->count + other->count;
+    accumulator->m2 += other->m2 + delta * delta * ((double)accumulator->count * other->count / count);
+    accumulator->count = count;
+    accumulator->sum += other->sum;
+    if (other->min < accumulator->min) accumulator->min = other->min;
+    if (other->max > accumulator->max) accumulator->max = other->max;
+}
+
+/**
+ * @brief Reduces one block of at most METRIC_BLOCK values.
+ *
+ * Values are shifted by the first one so that the squared deviations stay small and
+ * the sum of squares does not cancel; the loop has no branches and no dependency
+ * other than its accumulators, so it vectorizes.
+ *
+ * @param column The values (count > 0).
+ * @param count Their number.
+ * @return The block's accumulator.
+ */
+static MetricAccumulator reduce_block(const int* column, int count) {
+    const long long shift = column[0];
+    long long shifted_sum = 0;
+    double shifted_squares = 0;
+    int min = column[0];
+    int max = column[0];
+
+    for (int i = 0; i < count; i++) {
+        int value = column[i];
+        long long offset = value - shift;
+        shifted_sum += offset;
+        shifted_squares += (double)offset * (double)offset;
+        min = (value < min) ? value : min;
+        max = (value > max) ? value : max;
+    }
+
+    MetricAccumulator block;
+    block.count = count;
+    block.sum = shifted_sum + shift * count;
+    block.min = min;
+    block.max = max;
+    block.m2 = shifted_squares - (double)shifted_sum * shifted_sum / count;
+    if (block.m2 < 0) block.m2 = 0;
+    return block;
+}
+
+/**
+ * @brief Reduces a slice block by block into its own partial accumulator.
+ * @param arg The MetricSlice.
+ * @return NULL.
+ */
+static void* reduce_slice(void* arg) {
+    MetricSlice* slice = (MetricSlice*)arg;
+    metric_init(&slice->partial);
+    for (size_t start = 0; start < slice->count; start += METRIC_BLOCK) {
+        size_t length = slice->count - start;
+        if (length > METRIC_BLOCK) length = METRIC_BLOCK;
+        MetricAccumulator block = reduce_block(slice->column + start, (int)length);
+        metric_merge(&slice->partial, &block);
+    }
+    return NULL;
+}
+
+void metric_add_column(MetricAccumulator* accumulator, const int* column, size_t count, int threads) {
+    if (count == 0) return;
+
+    size_t max_threads = count / METRIC_PARALLEL_MIN_PER_THREAD;
+    size_t slice_count = (threads > 1) ? (size_t)threads : 1;
+    if (slice_count > max_threads) slice_count = (max_threads > 0) ? max_threads : 1;
+
+    MetricSlice* slices = (slice_count > 1) ? (MetricSlice*)malloc(slice_count * sizeof(MetricSlice)) : NULL;
+    pthread_t* workers = (slice_count > 1) ? (pthread_t*)malloc((slice_count - 1) * sizeof(pthread_t)) : NULL;
+    if (!slices || !workers) {
+        // Single-threaded (or out of memory): the caller reduces the whole column
+        free(slices);
+        free(workers);
+        MetricSlice whole = { .column = column, .count = count };
+        reduce_slice(&whole);
+        metric_merge(accumulator, &whole.partial);
+        return;
+    }
+
+    // Contiguous slices, the first one for the caller; slices whose thread fails to start run inline
+    size_t share = count / slice_count;
+    for (size_t s = 0; s < slice_count; s++) {
+        slices[s].column = column + s * share;
+        slices[s].count = (s + 1 < slice_count) ? share : count - s * share;
+    }
+    bool* started = (bool*)calloc(slice_count, sizeof(bool));
+    for (size_t s = 1; s < slice_count && started; s++) {
+        started[s] = pthread_create(&workers[s - 1], NULL, reduce_slice, &slices[s]) == 0;
+    }
+    reduce_slice(&slices[0]);
+    for (size_t s = 1; s < slice_count; s++) {
+        if (started && started[s]) pthread_join(workers[s - 1], NULL);
+        else reduce_slice(&slices[s]);
+    }
+
+    // Merging in slice order keeps the result independent of thread timing
+    for (size_t s = 0; s < slice_count; s++) {
+        metric_merge(accumulator, &slices[s].partial);
+    }
+    free(started);
+    free(slices);
+    free(workers);
+}
+
+MetricSummary metric_summarize(const MetricAccumulator* accumulator) {
+    MetricSummary summary = { 0 };
+    if (accumulator->count == 0) return summary;
+    summary.count = accumulator->count;
+    summary.total = accumulator->sum;
+    summary.min = accumulator->min;
+    summary.max = accumulator->max;
+    summary.mean = (double)accumulator->sum / accumulator->count;
+    summary.variance = (accumulator->count > 1) ? accumulator->m2 / accumulator->count : 0;
+    return summary;
+}
+
+
+/**
+ * @brief Maps a value to its histogram bucket.
+ *
+ * Small values get a bucket each; above that, a value keeps its top
+ * LATENCY_HISTOGRAM_PRECISION_BITS bits and the buckets of one power of two
+ * follow those of the previous one.
+ *
+ * @param value A non-negative value.
+ * @return Its bucket index.
+ */
+static int histogram_bucket(int value) {
+    if (value < 2 * LATENCY_HISTOGRAM_HALF_BUCKETS) return value;
+    int shift = (31 - __builtin_clz((unsigned)value)) - (LATENCY_HISTOGRAM_PRECISION_BITS - 1);
+    return shift * LATENCY_HISTOGRAM_HALF_BUCKETS + (value >> shift);
+}
+
+/**
+ * @brief Largest value a bucket holds.
+ * @param bucket A bucket index.
+ * @return The top of its range.
+ */
+static long long histogram_bucket_top(int bucket) {
+    if (bucket < 2 * LATENCY_HISTOGRAM_HALF_BUCKETS) return bucket;
+    int shift = bucket / LATENCY_HISTOGRAM_HALF_BUCKETS - 1;
+    long long mantissa = bucket - (long long)shift * LATENCY_HISTOGRAM_HALF_BUCKETS;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void latency_histogram_init(LatencyHistogram* histogram) {
+    memset(histogram, 0, sizeof(LatencyHistogram));
+}
+
+void latency_histogram_record(LatencyHistogram* histogram, int value) {
+    if (value < 0) value = 0;
+    histogram->counts[histogram_bucket(value)]++;
+    histogram->total_count++;
+    if (value > histogram->max) histogram->max = value;
+}
+
+void latency_histogram_merge(LatencyHistogram* histogram, const LatencyHistogram* other) {
+    for (int b = 0; b < LATENCY_HISTOGRAM_BUCKETS; b++) {
+        histogram->counts[b] += other->counts[b];
+    }
+    histogram->total_count += other->total_count;
+    if (other->max > histogram->max) histogram->max = other->max;
+}
+
+int latency_histogram_percentile(const LatencyHistogram* histogram, double percentile) {
+    if (histogram->total_count == 0) return 0;
+    if (percentile < 0) percentile = 0;
+    if (percentile > 100) percentile = 100;
+
+    // Rank of the value asked for, counting from 1
+    long long rank = (long long)(percentile / 100.0 * histogram->total_count);
+    if ((double)rank < percentile / 100.0 * histogram->total_count) rank++;
+    if (rank < 1) rank = 1;
+
+    long long seen = 0;
+    for (int b = 0; b < LATENCY_HISTOGRAM_BUCKETS; b++) {
+        seen += histogram->counts[b];
+        if (seen >= rank) {
+            long long top = histogram_bucket_top(b);
+            return (top < histogram->max) ? (int)top : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+LatencyPercentiles latency_histogram_percentiles(const LatencyHistogram* histogram) {
+    LatencyPercentiles percentiles;
+    percentiles.p50 = latency_histogram_percentile(histogram, 50);
+    percentiles.p90 = latency_histogram_percentile(histogram, 90);
+    percentiles.p99 = latency_histogram_percentile(histogram, 99);
+    percentiles.p999 = latency_histogram_percentile(histogram, 99.9);
+    percentiles.max = histogram->max;
+    return percentiles;
+}
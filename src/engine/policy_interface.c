@@ -10,20 +10,27 @@
  */
 
 #include "../../headers/engine/policy_interface.h"
+#include "../../headers/engine/profile.h"
 #include "../../headers/policies/policies.h" // The new header with VTable info
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 /**
- * @brief Maximum number of policies that can be registered.
+ * @brief Initial capacity of the registrar; it doubles whenever it fills up.
  */
-#define MAX_POLICIES 10
+#define INITIAL_POLICY_CAPACITY 8
 
 /**
- * @brief Static array to hold pointers to all registered PolicyVTables.
+ * @brief Dynamic array holding pointers to all registered PolicyVTables.
  */
-static const PolicyVTable* policy_registrar[MAX_POLICIES];
+static const PolicyVTable** policy_registrar = NULL;
+
+/**
+ * @brief Cache for storing names of registered policies (parallel to policy_registrar).
+ */
+static const char** policy_names = NULL;
 
 /**
  * @brief Counter for the number of currently registered policies.
@@ -31,9 +38,14 @@ static const PolicyVTable* policy_registrar[MAX_POLICIES];
 static int registered_policy_count = 0;
 
 /**
- * @brief Cache for storing names of registered policies.
+ * @brief Allocated length of policy_registrar and policy_names.
  */
-static const char* policy_names[MAX_POLICIES]; // Cache for policy names
+static int policy_capacity = 0;
+
+/**
+ * @brief Guards every access to the registrar, so policies can be created from any thread.
+ */
+static pthread_mutex_t registrar_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /**
  * @brief Internal representation of a Policy.
@@ -45,33 +57,83 @@ struct Policy {
     void* concrete_policy_data; /**< Pointer to the actual policy-specific data structure. */
 };
 
+/**
+ * @brief Finds a registered policy by name. The caller must hold registrar_lock.
+ *
+ * @param policy_name The name to look up.
+ * @return The policy's VTable, or NULL if no policy with that name is registered.
+ */
+static const PolicyVTable* find_policy_locked(const char* policy_name) {
+    for (int i = 0; i < registered_policy_count; i++) {
+        if (strcmp(policy_names[i], policy_name) == 0) {
+            return policy_registrar[i];
+        }
+    }
+    return NULL;
+}
+
 /**
  * @brief Registers a scheduling policy with the system.
  *
  * This function adds a given PolicyVTable to the internal registrar, making
- * the policy available for use by the scheduler engine.
+ * the policy available for use by the scheduler engine. Registering a name
+ * that is already known is a no-op, so repeated registration is harmless.
+ * Safe to call from any thread.
  *
  * @param vtable A pointer to the constant PolicyVTable structure of the policy to register.
  */
 void register_policy(const PolicyVTable* vtable) {
-    if (registered_policy_count < MAX_POLICIES) {
-        policy_registrar[registered_policy_count] = vtable;
-        policy_names[registered_policy_count] = vtable->name;
-        registered_policy_count++;
-    } else {
-        fprintf(stderr, "Policy Registrar Error: Exceeded maximum number of policies (%d).\n", MAX_POLICIES);
+    if (!vtable || !vtable->name) return;
+
+    pthread_mutex_lock(&registrar_lock);
+    if (find_policy_locked(vtable->name)) {
+        pthread_mutex_unlock(&registrar_lock);
+        return;
     }
+
+    if (registered_policy_count == policy_capacity) {
+        int new_capacity = policy_capacity ? policy_capacity * 2 : INITIAL_POLICY_CAPACITY;
+        const PolicyVTable** new_registrar = (const PolicyVTable**)realloc(policy_registrar, new_capacity * sizeof(const PolicyVTable*));
+        if (!new_registrar) {
+            perror("Policy Registrar: Failed to grow the registrar");
+            pthread_mutex_unlock(&registrar_lock);
+            return;
+        }
+        policy_registrar = new_registrar;
+
+        const char** new_names = (const char**)realloc(policy_names, new_capacity * sizeof(const char*));
+        if (!new_names) {
+            perror("Policy Registrar: Failed to grow the policy name cache");
+            pthread_mutex_unlock(&registrar_lock);
+            return;
+        }
+        policy_names = new_names;
+        policy_capacity = new_capacity;
+    }
+
+    policy_registrar[registered_policy_count] = vtable;
+    policy_names[registered_policy_count] = vtable->name;
+    registered_policy_count++;
+    pthread_mutex_unlock(&registrar_lock);
 }
 
 /**
  * @brief Retrieves an array of names of all available (registered) policies.
  *
+ * The built-in policies are registered on first use. The returned array stays
+ * valid until the next call to register_policy adds a new policy.
+ *
  * @param count A pointer to an integer where the number of available policies will be stored.
  * @return A constant array of strings, where each string is the name of a registered policy.
  */
 const char** get_available_policies(int* count) {
+    register_all_policies();
+
+    pthread_mutex_lock(&registrar_lock);
     *count = registered_policy_count;
-    return (const char**)policy_names;
+    const char** names = policy_names;
+    pthread_mutex_unlock(&registrar_lock);
+    return names;
 }
 
 /**
@@ -79,20 +141,34 @@ const char** get_available_policies(int* count) {
  *
  * This function looks up the policy by name and, if found, uses its VTable's
  * create function to instantiate the policy-specific data and wrap it in a
- * generic Policy structure.
+ * generic Policy structure. The built-in policies are registered on first use,
+ * and the function may be called from several threads at once.
  *
  * @param policy_name The name of the policy to create (e.g., "fifo", "rr").
  * @param quantum The time quantum to use for quantum-based policies (ignored by others).
  * @return A pointer to a newly created Policy object, or NULL if creation fails or policy is not found.
  */
 Policy* policy_create(const char* policy_name, int quantum) {
-    const PolicyVTable* vtable = NULL;
-    for (int i = 0; i < registered_policy_count; i++) {
-        if (strcmp(policy_registrar[i]->name, policy_name) == 0) {
-            vtable = policy_registrar[i];
-            break;
-        }
-    }
+    PolicyOptions options = { .quantum = quantum, .mlfq = NULL };
+    return policy_create_with_options(policy_name, &options);
+}
+
+/**
+ * @brief Creates a new instance of a scheduling policy with explicit options.
+ *
+ * Same as policy_create, but hands the whole option block to the policy's
+ * create function, which rejects options it cannot use by returning NULL.
+ *
+ * @param policy_name The name of the policy to create (e.g., "mlfq").
+ * @param options The policy options (quantum, MLFQ tuning).
+ * @return A pointer to a newly created Policy object, or NULL if creation fails or policy is not found.
+ */
+Policy* policy_create_with_options(const char* policy_name, const PolicyOptions* options) {
+    register_all_policies();
+
+    pthread_mutex_lock(&registrar_lock);
+    const PolicyVTable* vtable = find_policy_locked(policy_name);
+    pthread_mutex_unlock(&registrar_lock);
 
     if (!vtable) {
         fprintf(stderr, "Policy Interface Error: Policy '%s' not recognized or not registered.\n", policy_name);
@@ -106,7 +182,7 @@ Policy* policy_create(const char* policy_name, int quantum) {
     }
 
     new_internal_policy->vtable = vtable;
-    new_internal_policy->concrete_policy_data = vtable->create(quantum);
+    new_internal_policy->concrete_policy_data = vtable->create(options);
 
     if (!new_internal_policy->concrete_policy_data) {
         fprintf(stderr, "Policy Interface Error: Failed to create concrete policy data for '%s'.\n", policy_name);
@@ -143,6 +219,7 @@ void policy_destroy(Policy* policy) {
  */
 void policy_add_process(Policy* policy, Process* process) {
     if (!policy || !process) return;
+    PROFILE_CALL(PROFILE_CALL_ADD_PROCESS);
     policy->vtable->add_process(policy->concrete_policy_data, process);
 }
 
@@ -158,6 +235,7 @@ void policy_add_process(Policy* policy, Process* process) {
  */
 Process* policy_get_next_process(Policy* policy) {
     if (!policy) return NULL;
+    PROFILE_CALL(PROFILE_CALL_GET_NEXT_PROCESS);
     return policy->vtable->get_next_process(policy->concrete_policy_data);
 }
 
@@ -172,6 +250,7 @@ Process* policy_get_next_process(Policy* policy) {
  */
 void policy_tick(Policy* policy) {
     if (!policy) return;
+    PROFILE_CALL(PROFILE_CALL_TICK);
     // Tick is optional
     if (policy->vtable->tick) {
         policy->vtable->tick(policy->concrete_policy_data);
@@ -191,6 +270,7 @@ void policy_tick(Policy* policy) {
  */
 bool policy_needs_reschedule(Policy* policy, Process* running_process) {
     if (!policy) return true;
+    PROFILE_CALL(PROFILE_CALL_NEEDS_RESCHEDULE);
     if (policy->vtable->needs_reschedule) {
         return policy->vtable->needs_reschedule(policy->concrete_policy_data, running_process);
     }
@@ -210,6 +290,7 @@ bool policy_needs_reschedule(Policy* policy, Process* running_process) {
  */
 int policy_get_quantum(Policy* policy, Process* process) {
     if (!policy) return 0;
+    PROFILE_CALL(PROFILE_CALL_GET_QUANTUM);
     if (policy->vtable->get_quantum) {
         return policy->vtable->get_quantum(policy->concrete_policy_data, process);
     }
@@ -228,7 +309,50 @@ int policy_get_quantum(Policy* policy, Process* process) {
  */
 void policy_demote_process(Policy* policy, Process* process) {
     if (!policy) return;
+    PROFILE_CALL(PROFILE_CALL_DEMOTE_PROCESS);
     if (policy->vtable->demote_process) {
         policy->vtable->demote_process(policy->concrete_policy_data, process);
     }
+}
+
+/**
+ * @brief Reports how many upcoming executed ticks cannot change the policy's decisions.
+ *
+ * Policies without the callback and without a tick callback have no clock of their
+ * own: only arrivals and completions change their decisions, so every tick may be
+ * skipped. Policies with a tick callback but no ticks_until_event are treated
+ * conservatively: no tick may be skipped, so the engine steps them tick by tick.
+ *
+ * @param policy A pointer to the Policy object.
+ * @param running_process A pointer to the currently running process, or NULL if CPU is idle.
+ * @return The number of ticks that may be skipped (POLICY_NO_EVENT if unbounded).
+ */
+int policy_ticks_until_event(Policy* policy, Process* running_process) {
+    if (!policy) return 0;
+    PROFILE_CALL(PROFILE_CALL_TICKS_UNTIL_EVENT);
+    if (policy->vtable->ticks_until_event) {
+        return policy->vtable->ticks_until_event(policy->concrete_policy_data, running_process);
+    }
+    return policy->vtable->tick ? 0 : POLICY_NO_EVENT;
+}
+
+/**
+ * @brief Advances the policy's clock by several executed ticks at once.
+ *
+ * Falls back to calling the tick callback once per tick when the policy does not
+ * provide a bulk advance, and does nothing when it has neither.
+ *
+ * @param policy A pointer to the Policy object.
+ * @param ticks The number of executed ticks to account for.
+ */
+void policy_advance(Policy* policy, int ticks) {
+    if (!policy || ticks <= 0) return;
+    PROFILE_CALL(PROFILE_CALL_ADVANCE);
+    if (policy->vtable->advance) {
+        policy->vtable->advance(policy->concrete_policy_data, ticks);
+    } else if (policy->vtable->tick) {
+        for (int i = 0; i < ticks; i++) {
+            policy->vtable->tick(policy->concrete_policy_data);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "../../headers/engine/profile.h"
+
+#include <stddef.h>
+
+
+#ifdef SCHED_PROFILE
+// Thread-local so parallel sweeps profile (or not) each run on its own
+_Thread_local EngineProfile* profile_active = NULL;
+#endif
+
+EngineProfile* profile_attach(EngineProfile* profile) {
+#ifdef SCHED_PROFILE
+    EngineProfile* previous = profile_active;
+    profile_active = profile;
+    return previous;
+#else
+    (void)profile;
+    return NULL;
+#endif
+}
@@ -1,12 +1,36 @@
 #include "../../headers/engine/scheduler_engine.h"
-#include "../../headers/parser/config_parser.h"
+#include "../../headers/engine/workload.h"
 #include "../../headers/engine/policy_interface.h"
+#include "../../headers/engine/profile.h"
+#include "../../headers/data_structures/timer_wheel.h"
+#include "../../headers/output/logger.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 
+/**
+ * @brief Internal structure holding the state of one simulated CPU.
+ */
+typedef struct {
+    Process* running_process;           /**< Pointer to the process currently executing on this CPU. */
+    int queue;                          /**< Index of the run queue (policy instance) this CPU dispatches from. */
+    bool reschedule;                    /**< Set while a tick decides whether this CPU picks a new process. */
+    bool last_pick_empty;               /**< True if this CPU asked for a process in the last tick and got none. */
+    int stall_remaining;                /**< Ticks left before a stolen process starts running here. */
+    bool ticked;                        /**< True if this CPU did work since its policy clock last advanced. */
+    GanttSegment* temp_gantt_chart;     /**< Dynamically allocated array of this CPU's Gantt chart segments. */
+    int temp_gantt_segment_count;       /**< Current number of segments in the Gantt chart. */
+    int temp_gantt_capacity;            /**< Allocated capacity of the Gantt chart array. */
+    long long busy_time;                /**< Time this CPU has been busy (not idle). */
+    int steals;                         /**< Processes this CPU pulled from other run queues. */
+    long long migration_time;           /**< Ticks spent stalled on migrations. */
+    int id;                             /**< Index of this CPU. */
+    const ResultsSink* sink;            /**< Receives closed segments instead of the chart keeping them (NULL: keep all). */
+    TimerNode timer;                    /**< Next tick this CPU needs a decision (completion, quantum, stall end or policy timer). */
+} CpuState;
+
 /**
  * @brief Internal structure to maintain the simulation's current state.
  */
@@ -14,13 +38,45 @@ typedef struct {
     int current_time;                   /**< The current simulated time. */
     Process* all_processes;             /**< Array of all processes in the simulation. */
     int total_process_count;            /**< Total number of processes. */
-    Process* running_process;           /**< Pointer to the process currently executing on the CPU. */
-    Policy* active_policy_handle;       /**< Handle to the active scheduling policy. */
+    CpuState* cpus;                     /**< The simulated CPUs. */
+    int cpu_count;                      /**< Number of simulated CPUs. */
+    Policy** queues;                    /**< Policy instances: one shared queue, or one per CPU. */
+    int* queued_counts;                 /**< Number of processes waiting in each policy instance. */
+    int queue_count;                    /**< Number of policy instances. */
+    int balance_interval;               /**< Steal on ticks that are multiples of this (0: never). */
+    int migration_cost;                 /**< Stall, in ticks, before a stolen process runs. */
+    int migration_count;                /**< Number of processes stolen so far. */
     int terminated_count;               /**< Number of processes that have completed execution. */
-    GanttEvent* temp_gantt_chart;       /**< Dynamically allocated array for Gantt chart events. */
-    int temp_gantt_event_count;         /**< Current number of events in the Gantt chart. */
-    long long total_cpu_busy_time;      /**< Total time the CPU has been busy (not idle). */
-    bool verbose_logging;               /**< Flag to enable/disable verbose output during simulation. */
+    long long decisions;                /**< Scheduling decisions so far (picks of a next process, empty or not). */
+    long long total_cpu_busy_time;      /**< Total time the CPUs have been busy (not idle), summed over CPUs. */
+    Logger* logger;                     /**< Receives scheduling events (NULL: not logging; testing it is the whole cost). */
+    int next_arrival_index;             /**< First process (in arrival order) that has not arrived yet. */
+    TimerWheel* calendar;               /**< Event calendar: the next tick each timer needs simulated. */
+    TimerNode arrival_timer;            /**< Fires on the next arrival time. */
+    TimerNode balance_timer;            /**< Fires on the next balancing tick an idle CPU could steal on. */
+    bool event_driven;                  /**< True when quiet ticks are skipped (CPU timers are only armed then). */
+    ImbalanceSegment* imbalance;        /**< Run-queue imbalance over time (per-CPU queues only). */
+    int imbalance_count;                /**< Number of imbalance segments. */
+    int imbalance_capacity;             /**< Allocated capacity of the imbalance array. */
+    long long imbalance_area;           /**< Sum of imbalance over all ticks. */
+    int max_imbalance;                  /**< Largest imbalance seen. */
+    const ProcessSource* source;        /**< Streaming runs: where arrivals come from (NULL: all_processes). */
+    Process pending;                    /**< Streaming runs: the next process to arrive, already pulled. */
+    bool has_pending;                   /**< Streaming runs: true while pending holds a process. */
+    bool stream_failed;                 /**< Streaming runs: the source failed or broke arrival order. */
+    int admitted_count;                 /**< Streaming runs: processes pulled into the simulation so far. */
+    int peak_resident;                  /**< Streaming runs: most processes in flight at once. */
+    const ResultsSink* sink;            /**< Receives each process as it terminates (NULL: none). */
+    int* waiting_column;                /**< Table runs: waiting time of each terminated process, in termination order. */
+    int* turnaround_column;             /**< Table runs: turnaround time of each terminated process, in termination order. */
+    int* response_column;               /**< Table runs: response time of each terminated process, in termination order. */
+    MetricAccumulator waiting_metrics;      /**< Streaming runs: waiting times of the terminated processes. */
+    MetricAccumulator turnaround_metrics;   /**< Streaming runs: turnaround times of the terminated processes. */
+    MetricAccumulator response_metrics;     /**< Streaming runs: response times of the terminated processes. */
+    int metrics_threads;                /**< Threads the final reduction of the metric columns may use. */
+    SimulationResult* results;          /**< Receives each terminated process in its latency histograms. */
+    TelemetrySeries* telemetry;         /**< Samples being recorded (NULL: telemetry off). */
+    long long next_sample_time;         /**< Next tick telemetry samples (a multiple of the stride). */
 } SimState;
 
 
@@ -28,24 +84,70 @@ typedef struct {
  * @brief Helper Function Prototypes.
  * Doxygen for these functions are with their definitions.
  */
-static void initialize_sim_state(SimState* state, Process* processes, int count, Policy* policy_handle, bool verbose);
+static void initialize_sim_state(SimState* state, Process* processes, int count, CpuState* cpus, int cpu_count, Policy** queues, int* queued_counts, int queue_count, const SimParameters* params);
 static void simulate_tick(SimState* state);
 static void calculate_final_metrics(SimState* state, SimulationResult* results);
-static void add_gantt_event_to_state(SimState* state, int time, const char* process_name);
-static int compare_processes_by_arrival(const void* a, const void* b);
+static void add_gantt_event_to_state(CpuState* cpu, int time, int process_id);
+static void add_gantt_run_to_state(CpuState* cpu, int start_time, int ticks, int process_id);
+static void skip_quiet_ticks(SimState* state);
+static void enqueue_process(SimState* state, int queue, Process* process, bool demote);
+static Process* dequeue_process(SimState* state, int queue);
+static Process* steal_process(SimState* state, int thief);
+static int least_loaded_queue(const SimState* state);
+static void record_imbalance(SimState* state, int start_time, int ticks);
+static void record_telemetry(SimState* state, int start_time, int ticks);
+static void advance_policy_clocks(SimState* state, int ticks);
+static SimulationResult* execute_simulation(SimulationResult* final_results, Process* processes, int count, const ProcessSource* source, const SimParameters* params);
+static void flush_gantt_sink(CpuState* cpu);
+static bool simulation_pending(const SimState* state);
+static void admit_arrivals(SimState* state);
+static void pull_next_arrival(SimState* state);
+static void retire_streamed_process(SimState* state, Process* process);
+static void release_streamed_processes(SimState* state);
+static void arm_arrival_timer(SimState* state);
+static void arm_decision_timers(SimState* state);
 
 
 /**
  * @brief Runs the CPU scheduling simulation based on provided parameters.
  *
- * This is the main entry point for the simulation. It parses the configuration,
- * initializes the chosen scheduling policy, simulates the execution tick by tick,
- * and calculates the final performance metrics.
+ * Convenience wrapper that parses the configuration named in the parameters and
+ * simulates it once. Callers running several simulations on the same file should
+ * load a Workload themselves and use run_simulation_on.
  *
  * @param params A pointer to a SimParameters structure containing simulation configuration.
  * @return A pointer to a SimulationResult structure containing detailed results, or NULL if an error occurs.
  */
 SimulationResult* run_simulation(const SimParameters* params) {
+    Workload* workload = workload_load(params->config_filepath);
+    if (!workload) {
+        fprintf(stderr, "Scheduler Engine: Failed to parse config file '%s' or no processes found.\n", params->config_filepath);
+        return NULL;
+    }
+
+    SimulationResult* results = run_simulation_on(workload, params);
+    workload_free(workload);
+    return results;
+}
+
+/**
+ * @brief Runs the CPU scheduling simulation on an already parsed workload.
+ *
+ * This is the main entry point for the simulation. It copies the per-run process
+ * state out of the workload, initializes the chosen scheduling policy, simulates
+ * the execution and calculates the final performance metrics. The workload itself
+ * is left untouched, and params->config_filepath is ignored.
+ *
+ * In the default event-driven mode, every decision tick is simulated exactly like the
+ * reference loop, and the quiet ticks in between (no arrival, no completion, no quantum
+ * expiry, no policy timer) are applied in one step. A tick callback or SIM_ENGINE_TICK
+ * keeps the original one-tick-at-a-time loop.
+ *
+ * @param workload The parsed workload to simulate.
+ * @param params A pointer to a SimParameters structure containing simulation configuration.
+ * @return A pointer to a SimulationResult structure containing detailed results, or NULL if an error occurs.
+ */
+SimulationResult* run_simulation_on(const Workload* workload, const SimParameters* params) {
     // Allocating the final SimulationResult structure early
     SimulationResult* final_results = (SimulationResult*)calloc(1, sizeof(SimulationResult));
     if (!final_results) {
@@ -53,59 +155,274 @@ SimulationResult* run_simulation(const SimParameters* params) {
         return NULL;
     }
 
-    // Parsing Configuration File
-    int parsed_process_count = 0;
-    Process* parsed_processes = parse_config_file(params->config_filepath, &parsed_process_count);
-    if (!parsed_processes || parsed_process_count == 0) {
-        fprintf(stderr, "Scheduler Engine: Failed to parse config file '%s' or no processes found.\n", params->config_filepath);
+    // Copying the processes this run will mutate, already in arrival order
+    int parsed_process_count = workload->process_count;
+    Process* parsed_processes = workload_copy_by_arrival(workload);
+    if (!parsed_processes) {
         free(final_results);
         return NULL;
     }
     
-    // Linking parsed processes to the final_results
+    // Linking the copied processes to the final_results
     final_results->processes = parsed_processes;
     final_results->process_count = parsed_process_count;
 
-    // Creating the policy instance
-    Policy* policy_handle = policy_create(params->policy_name, params->quantum);
-    if (!policy_handle) {
-        fprintf(stderr, "Scheduler Engine: Failed to create policy handle for '%s'.\n", params->policy_name);
+    // Id table: processes are in arrival order, ids stay in config order
+    final_results->process_by_id = (Process**)malloc(parsed_process_count * sizeof(Process*));
+    if (!final_results->process_by_id) {
+        perror("Scheduler Engine: Failed to allocate process id table");
+        free_simulation_results(final_results);
+        return NULL;
+    }
+    for (int i = 0; i < parsed_process_count; i++) {
+        final_results->process_by_id[parsed_processes[i].original_index] = &parsed_processes[i];
+    }
+
+    return execute_simulation(final_results, parsed_processes, parsed_process_count, NULL, params);
+}
+
+/**
+ * @brief Pulls the next process of a config file for run_simulation_streamed.
+ *
+ * @param context The open ConfigReader.
+ * @param process The process to fill.
+ * @return 1 if a process was read, 0 at the end of the file, -1 on error.
+ */
+static int next_from_reader(void* context, Process* process) {
+    return config_reader_next((ConfigReader*)context, process);
+}
+
+/**
+ * @brief Runs the simulation on a config file read one process at a time.
+ *
+ * @param params The simulation parameters; params->config_filepath names the file to stream.
+ * @return A pointer to a SimulationResult structure without a process table, or NULL if an error occurs.
+ */
+SimulationResult* run_simulation_streamed(const SimParameters* params) {
+    ConfigReader* reader = config_reader_open(params->config_filepath);
+    if (!reader) {
+        fprintf(stderr, "Scheduler Engine: Failed to open config file '%s' for streaming.\n", params->config_filepath);
+        return NULL;
+    }
+
+    ProcessSource source = { .next = next_from_reader, .context = reader };
+    SimulationResult* results = run_simulation_from_source(&source, params);
+    config_reader_close(reader);
+    return results;
+}
+
+/**
+ * @brief Runs the simulation on processes pulled from a source as they arrive.
+ *
+ * No process table is built: the engine holds the next process to arrive plus the
+ * processes between arrival and termination. Each finished process is handed to
+ * params->sink and freed, and the averages are accumulated as processes terminate.
+ *
+ * @param source The process source, in non-decreasing arrival order.
+ * @param params A pointer to a SimParameters structure containing simulation configuration.
+ * @return A pointer to a SimulationResult structure without a process table, or NULL if an error occurs.
+ */
+SimulationResult* run_simulation_from_source(const ProcessSource* source, const SimParameters* params) {
+    SimulationResult* final_results = (SimulationResult*)calloc(1, sizeof(SimulationResult));
+    if (!final_results) {
+        perror("Scheduler Engine: Failed to allocate final_results struct");
+        return NULL;
+    }
+    return execute_simulation(final_results, NULL, 0, source, params);
+}
+
+/**
+ * @brief Simulates a run once its processes (or their source) are known.
+ *
+ * Creates the CPUs and policy instances, runs the event-driven or tick loop until every
+ * process has terminated, and hands the timelines and metrics over to the results.
+ *
+ * @param final_results The results to fill (freed on error).
+ * @param processes The run's processes in arrival order, or NULL for a streaming run.
+ * @param count The number of processes in the array.
+ * @param source Streaming runs: the process source (NULL otherwise).
+ * @param params A pointer to a SimParameters structure containing simulation configuration.
+ * @return final_results, or NULL if an error occurs.
+ */
+static SimulationResult* execute_simulation(SimulationResult* final_results, Process* processes, int count, const ProcessSource* source, const SimParameters* params) {
+
+    // One lane per CPU in the results, one CpuState per CPU during the run
+    int cpu_count = (params->cpu_count > 0) ? params->cpu_count : 1;
+    int queue_count = (params->queue_model == SIM_QUEUE_PER_CPU) ? cpu_count : 1;
+    final_results->cpu_count = cpu_count;
+    final_results->cpu_lanes = (CpuLane*)calloc(cpu_count, sizeof(CpuLane));
+    CpuState* cpus = (CpuState*)calloc(cpu_count, sizeof(CpuState));
+    Policy** queues = (Policy**)calloc(queue_count, sizeof(Policy*));
+    int* queued_counts = (int*)calloc(queue_count, sizeof(int));
+    if (!final_results->cpu_lanes || !cpus || !queues || !queued_counts) {
+        perror("Scheduler Engine: Failed to allocate CPU state");
+        free(cpus);
+        free(queues);
+        free(queued_counts);
         free_simulation_results(final_results);
         return NULL;
     }
 
+    // Creating the policy instances (one per run queue)
+    PolicyOptions policy_options = { .quantum = params->quantum, .mlfq = params->mlfq };
+    for (int q = 0; q < queue_count; q++) {
+        queues[q] = policy_create_with_options(params->policy_name, &policy_options);
+        if (!queues[q]) {
+            fprintf(stderr, "Scheduler Engine: Failed to create policy handle for '%s'.\n", params->policy_name);
+            for (int j = 0; j < q; j++) policy_destroy(queues[j]);
+            free(cpus);
+            free(queues);
+            free(queued_counts);
+            free_simulation_results(final_results);
+            return NULL;
+        }
+    }
+
     // Initializing the simulation state
     SimState state;
     memset(&state, 0, sizeof(SimState));
-    initialize_sim_state(&state, parsed_processes, parsed_process_count, policy_handle, params->verbose);
+    initialize_sim_state(&state, processes, count, cpus, cpu_count, queues, queued_counts, queue_count, params);
+    state.results = final_results;
+    latency_histogram_init(&final_results->waiting_histogram);
+    latency_histogram_init(&final_results->response_histogram);
+    latency_histogram_init(&final_results->turnaround_histogram);
+
+    // Live UIs want to see every tick, so they always run the reference loop
+    bool event_driven = (params->engine_mode == SIM_ENGINE_EVENT) && !params->tick_callback;
+    state.event_driven = event_driven;
+    state.calendar = timer_wheel_create(0);
+    if (!state.calendar) {
+        perror("Scheduler Engine: Failed to allocate the event calendar");
+        state.stream_failed = true;
+    }
+
+    // Telemetry samples go straight into the result's columns
+    if (params->telemetry_stride > 0) {
+        final_results->telemetry = telemetry_create(params->telemetry_stride, cpu_count);
+        state.telemetry = final_results->telemetry;
+        if (!state.telemetry) {
+            perror("Scheduler Engine: Failed to allocate the telemetry series");
+            state.stream_failed = true;
+        } else if (!source && count > 0) {
+            // The last arrival plus every burst bounds the makespan: reserving that many samples
+            // keeps the columns from being copied as they grow (untouched pages cost nothing)
+            long long makespan_bound = processes[count - 1].arrival_time;
+            for (int i = 0; i < count; i++) makespan_bound += processes[i].burst_time;
+            long long samples = makespan_bound / params->telemetry_stride + 1;
+            telemetry_reserve(state.telemetry, (samples < INT_MAX) ? (int)samples : INT_MAX);
+        }
+    }
+
+    // Table runs record each process's metrics in columns as it terminates, reduced at the end
+    if (!source && count > 0) {
+        state.waiting_column = (int*)malloc(3 * (size_t)count * sizeof(int));
+        if (!state.waiting_column) {
+            perror("Scheduler Engine: Failed to allocate the metric columns");
+            state.stream_failed = true;
+        } else {
+            state.turnaround_column = state.waiting_column + count;
+            state.response_column = state.waiting_column + 2 * (size_t)count;
+        }
+    }
+
+    // Streaming runs hold the first arrival before the clock starts
+    if (source && state.calendar) {
+        state.source = source;
+        pull_next_arrival(&state);
+        if (!state.has_pending && !state.stream_failed) {
+            fprintf(stderr, "Scheduler Engine: The process stream holds no processes.\n");
+            state.stream_failed = true;
+        }
+    }
+    if (state.calendar) arm_arrival_timer(&state);
+
+    // Verbose runs without a logger of their own get a text one on stdout for the run
+    Logger* run_logger = NULL;
+    state.logger = params->logger;
+    if (!state.logger && params->verbose) {
+        run_logger = logger_open(stdout, LOG_FORMAT_TEXT, 0);
+        state.logger = run_logger;
+    }
 
     if (params->verbose) {
-        printf("Scheduler Engine: Starting simulation for policy '%s' with %d processes :\n", params->policy_name, state.total_process_count);
+        if (source) printf("Scheduler Engine: Starting simulation for policy '%s' on a process stream :\n", params->policy_name);
+        else printf("Scheduler Engine: Starting simulation for policy '%s' with %d processes :\n", params->policy_name, state.total_process_count);
     }
 
-    while (state.terminated_count < state.total_process_count) {
+    // Profiled runs count their phases and policy calls into params->profile
+    EngineProfile* previous_profile = profile_attach(params->profile);
+    while (!state.stream_failed && simulation_pending(&state)) {
         simulate_tick(&state);
         state.current_time++;
         
         // Calling the live update callback if provided (For the TUI and GUI versions)
-        if (params->tick_callback) {
+        if (params->tick_callback && !source) {
             params->tick_callback(
                 state.current_time,
                 state.all_processes,
                 state.total_process_count,
-                state.running_process,
-                state.temp_gantt_chart,
-                state.temp_gantt_event_count
+                state.cpus[0].running_process,
+                state.cpus[0].temp_gantt_chart,
+                state.cpus[0].temp_gantt_segment_count
             );
         }
+
+        if (event_driven && !state.stream_failed && simulation_pending(&state)) {
+            skip_quiet_ticks(&state);
+        }
+    }
+
+    profile_attach(previous_profile);
+    if (params->profile) {
+        params->profile->ticks += state.current_time;
+        params->profile->decisions += state.decisions;
+    }
+
+    timer_wheel_destroy(state.calendar);
+    if (run_logger) logger_close(run_logger);
+    else if (state.logger) logger_flush(state.logger);
+    if (state.stream_failed) {
+        free(state.waiting_column);
+        release_streamed_processes(&state);
+        for (int c = 0; c < cpu_count; c++) free(cpus[c].temp_gantt_chart);
+        free(cpus);
+        for (int q = 0; q < queue_count; q++) policy_destroy(queues[q]);
+        free(queues);
+        free(queued_counts);
+        free(state.imbalance);
+        free_simulation_results(final_results);
+        return NULL;
+    }
+    if (source) {
+        final_results->process_count = state.admitted_count;
+        final_results->peak_resident_processes = state.peak_resident;
     }
     
     calculate_final_metrics(&state, final_results);
+    free(state.waiting_column);
     
-    final_results->gantt_chart = state.temp_gantt_chart;
-    final_results->gantt_event_count = state.temp_gantt_event_count;
+    // Handing each CPU's timeline over to the results (or its last segment to the sink)
+    for (int c = 0; c < cpu_count; c++) {
+        flush_gantt_sink(&cpus[c]);
+        CpuLane* lane = &final_results->cpu_lanes[c];
+        lane->segments = cpus[c].temp_gantt_chart;
+        lane->segment_count = cpus[c].temp_gantt_segment_count;
+        lane->busy_time = cpus[c].busy_time;
+        lane->utilization = (state.current_time > 0) ? (float)cpus[c].busy_time / state.current_time * 100.0f : 0;
+        lane->steals = cpus[c].steals;
+        lane->migration_time = cpus[c].migration_time;
+    }
+    final_results->gantt_segments = final_results->cpu_lanes[0].segments;
+    final_results->gantt_segment_count = final_results->cpu_lanes[0].segment_count;
+    final_results->imbalance_segments = state.imbalance;
+    final_results->imbalance_segment_count = state.imbalance_count;
+    free(cpus);
 
-    policy_destroy(policy_handle);
+    for (int q = 0; q < queue_count; q++) {
+        policy_destroy(queues[q]);
+    }
+    free(queues);
+    free(queued_counts);
     
     if (params->verbose) {
         printf("Scheduler Engine: Simulation finished at time %d.\n", state.current_time);
@@ -118,62 +435,121 @@ SimulationResult* run_simulation(const SimParameters* params) {
  * @brief Frees all dynamically allocated memory within a SimulationResult structure.
  *
  * This function is crucial for preventing memory leaks after a simulation run.
- * It frees the array of processes, the Gantt chart events, and the result structure itself.
+ * It frees the array of processes, every CPU's Gantt chart segments, and the result structure itself.
  *
  * @param results A pointer to the SimulationResult structure to be freed.
  */
 void free_simulation_results(SimulationResult* results) {
     if (!results) return;
     free(results->processes);
-    free(results->gantt_chart);
+    free(results->process_by_id);
+    if (results->cpu_lanes) {
+        // gantt_segments aliases the first lane
+        for (int c = 0; c < results->cpu_count; c++) {
+            free(results->cpu_lanes[c].segments);
+        }
+        free(results->cpu_lanes);
+    } else {
+        free(results->gantt_segments);
+    }
+    free(results->imbalance_segments);
+    telemetry_free(results->telemetry);
     free(results);
 }
 
-
 /**
- * @brief Comparison function for sorting processes based on their arrival time.
+ * @brief Expands the result's run segments back into one GanttEvent per tick.
  *
- * Used by `qsort` to ensure processes are handled in the order they arrive.
- * Ties are broken by the original index to maintain a stable sort.
+ * Only CPU 0's lane (results->gantt_segments) is expanded. Process names
+ * are resolved once per segment through the id table, so streaming results
+ * (which have none) cannot be expanded.
  *
- * @param a Pointer to the first Process.
- * @param b Pointer to the second Process.
- * @return Negative if a comes before b, positive if a comes after b, zero if equal.
+ * @param results The simulation results holding the segments and the process table.
+ * @param event_count Pointer to store the number of generated events.
+ * @return A dynamically allocated array of events, or NULL if there is nothing to expand.
  */
-static int compare_processes_by_arrival(const void* a, const void* b) {
-    Process* p1 = (Process*)a;
-    Process* p2 = (Process*)b;
-    if (p1->arrival_time < p2->arrival_time) return -1;
-    if (p1->arrival_time > p2->arrival_time) return 1;
-    // Tie-break with original index to maintain config order
-    if (p1->original_index < p2->original_index) return -1;
-    if (p1->original_index > p2->original_index) return 1;
-    return 0;
+GanttEvent* expand_gantt_segments(const SimulationResult* results, int* event_count) {
+    *event_count = 0;
+    if (!results || !results->process_by_id || !results->gantt_segments || results->gantt_segment_count <= 0) return NULL;
+    const GanttSegment* segments = results->gantt_segments;
+    int segment_count = results->gantt_segment_count;
+
+    long long total = 0;
+    for (int i = 0; i < segment_count; i++) {
+        total += segments[i].end_time - segments[i].start_time;
+    }
+
+    GanttEvent* events = (GanttEvent*)malloc(total * sizeof(GanttEvent));
+    if (!events) {
+        perror("Scheduler Engine: Failed to allocate expanded Gantt events");
+        return NULL;
+    }
+
+    int n = 0;
+    for (int i = 0; i < segment_count; i++) {
+        int id = segments[i].process_id;
+        const char* name = (id == GANTT_IDLE_ID) ? "IDLE" :
+                           (id == GANTT_MIGRATION_ID) ? "MIGRATE" : results->process_by_id[id]->name;
+        for (int t = segments[i].start_time; t < segments[i].end_time; t++) {
+            events[n].time = t;
+            events[n].process_id = id;
+            strncpy(events[n].process_name, name, sizeof(events[n].process_name) - 1);
+            events[n].process_name[sizeof(events[n].process_name) - 1] = '\0';
+            n++;
+        }
+    }
+    *event_count = n;
+    return events;
 }
 
+
 /**
  * @brief Initializes the simulation state before execution begins.
  *
- * Sets up initial values for current time, process counts, policy handle,
- * and resets all process-specific metrics. It also sorts processes by arrival time.
+ * Sets up initial values for current time, process counts, CPUs and run queues,
+ * and resets all process-specific metrics. Processes must already be in arrival order.
  *
  * @param state A pointer to the SimState structure to initialize.
  * @param processes An array of all processes loaded from the configuration.
  * @param count The number of processes in the array.
- * @param policy_handle A handle to the active scheduling policy.
- * @param verbose A boolean indicating whether verbose logging is enabled.
+ * @param cpus A zero-initialized array of cpu_count CPU states.
+ * @param cpu_count The number of simulated CPUs.
+ * @param queues The policy instances (one shared, or one per CPU).
+ * @param queued_counts A zero-initialized array of queue_count counters.
+ * @param queue_count The number of policy instances.
+ * @param params The simulation parameters (verbosity and load-balancing settings).
  */
-static void initialize_sim_state(SimState* state, Process* processes, int count, Policy* policy_handle, bool verbose) {
+static void initialize_sim_state(SimState* state, Process* processes, int count, CpuState* cpus, int cpu_count, Policy** queues, int* queued_counts, int queue_count, const SimParameters* params) {
     state->current_time = 0;
     state->all_processes = processes;
     state->total_process_count = count;
-    state->verbose_logging = verbose;
-    state->running_process = NULL;
-    state->active_policy_handle = policy_handle;
+    state->cpus = cpus;
+    state->cpu_count = cpu_count;
+    state->queues = queues;
+    state->queued_counts = queued_counts;
+    state->queue_count = queue_count;
+    state->balance_interval = (params->balance_interval > 0) ? params->balance_interval : 0;
+    state->migration_cost = (params->migration_cost > 0) ? params->migration_cost : 0;
+    state->sink = (params->sink && params->sink->on_process) ? params->sink : NULL;
+    state->migration_count = 0;
     state->terminated_count = 0;
-    state->temp_gantt_chart = NULL;
-    state->temp_gantt_event_count = 0;
     state->total_cpu_busy_time = 0;
+    state->next_arrival_index = 0;
+    state->metrics_threads = params->metrics_threads;
+    metric_init(&state->waiting_metrics);
+    metric_init(&state->turnaround_metrics);
+    metric_init(&state->response_metrics);
+
+    timer_init(&state->arrival_timer);
+    timer_init(&state->balance_timer);
+
+    // With a single shared queue every CPU dispatches from queue 0
+    for (int c = 0; c < cpu_count; c++) {
+        timer_init(&cpus[c].timer);
+        cpus[c].queue = (queue_count > 1) ? c : 0;
+        cpus[c].id = c;
+        cpus[c].sink = (params->sink && params->sink->on_segment) ? params->sink : NULL;
+    }
 
     // Initializing all processes (NEW state + remaining burst time + current quantum runtime + last executed time)
     for (int i = 0; i < count; i++) {
@@ -182,164 +558,746 @@ static void initialize_sim_state(SimState* state, Process* processes, int count,
         processes[i].current_quantum_runtime = 0; 
         processes[i].last_executed_time = 0;
     }
+}
+
+/**
+ * @brief Tells whether any process has yet to terminate.
+ *
+ * @param state A pointer to the SimState structure.
+ * @return True while a process is still to arrive, waiting or running.
+ */
+static bool simulation_pending(const SimState* state) {
+    if (state->source) return state->has_pending || state->terminated_count < state->admitted_count;
+    return state->terminated_count < state->total_process_count;
+}
+
+/**
+ * @brief Pulls the next process of a streaming run into state->pending.
+ *
+ * Only the fields a config provides are kept; every runtime field starts at 0.
+ * A source error, a decreasing arrival time or an invalid burst stops the run.
+ *
+ * @param state A pointer to the SimState structure of a streaming run.
+ */
+static void pull_next_arrival(SimState* state) {
+    Process next;
+    memset(&next, 0, sizeof(Process));
+    int status = state->source->next(state->source->context, &next);
+    state->has_pending = false;
+    if (status == 0) return;
+    if (status < 0) {
+        fprintf(stderr, "Scheduler Engine: The process stream failed after %d processes.\n", state->admitted_count);
+        state->stream_failed = true;
+        return;
+    }
 
-    // Sorting processes by arrival time
-    qsort(state->all_processes, count, sizeof(Process), compare_processes_by_arrival);
+    // pending still holds the previous arrival (all zeroes before the first one)
+    if (next.arrival_time < state->pending.arrival_time || next.burst_time <= 0) {
+        fprintf(stderr, "Scheduler Engine: Streamed process '%.31s' is out of arrival order or has no burst (processes must be sorted by arrival_time).\n", next.name);
+        state->stream_failed = true;
+        return;
+    }
+
+    memset(&state->pending, 0, sizeof(Process));
+    memcpy(state->pending.name, next.name, sizeof(next.name));
+    state->pending.name[sizeof(state->pending.name) - 1] = '\0';
+    state->pending.arrival_time = next.arrival_time;
+    state->pending.burst_time = next.burst_time;
+    state->pending.remaining_burst_time = next.burst_time;
+    state->pending.priority = next.priority;
+    state->pending.original_index = next.original_index;
+    state->pending.state = NEW;
+    state->has_pending = true;
 }
 
 /**
- * @brief Adds a new event to the dynamically growing Gantt chart.
+ * @brief Moves every process arriving at the current time into a run queue.
  *
- * This helper function reallocates memory for the Gantt chart and
- * stores the process name and time at which it was running.
+ * Only called when the arrival timer fires. With a process table, the processes are
+ * taken from the arrival-ordered cursor; a streaming run copies the pending processes
+ * that are due into their own allocations and pulls the next ones. Either way the
+ * arrival timer is then armed for the next arrival time.
  *
  * @param state A pointer to the SimState structure.
+ */
+static void admit_arrivals(SimState* state) {
+    if (!state->source) {
+        while (state->next_arrival_index < state->total_process_count &&
+               state->all_processes[state->next_arrival_index].arrival_time <= state->current_time) {
+            Process* process = &state->all_processes[state->next_arrival_index++];
+            process->state = READY;
+            enqueue_process(state, least_loaded_queue(state), process, false);
+            if (state->logger) {
+                logger_event(state->logger, LOG_EVENT_ARRIVAL, state->current_time, -1, process->original_index, process->name, 0);
+            }
+        }
+        arm_arrival_timer(state);
+        return;
+    }
+
+    while (state->has_pending && state->pending.arrival_time <= state->current_time) {
+        Process* process = (Process*)malloc(sizeof(Process));
+        if (!process) {
+            perror("Scheduler Engine: Failed to allocate a streamed process");
+            state->stream_failed = true;
+            return;
+        }
+        *process = state->pending;
+        process->state = READY;
+        state->admitted_count++;
+        int resident = state->admitted_count - state->terminated_count;
+        if (resident > state->peak_resident) state->peak_resident = resident;
+
+        enqueue_process(state, least_loaded_queue(state), process, false);
+        if (state->logger) {
+            logger_event(state->logger, LOG_EVENT_ARRIVAL, state->current_time, -1, process->original_index, process->name, 0);
+        }
+        pull_next_arrival(state);
+    }
+    arm_arrival_timer(state);
+}
+
+/**
+ * @brief Accounts a terminated process of a streaming run and frees it.
+ *
+ * @param state A pointer to the SimState structure of a streaming run.
+ * @param process The process that just terminated (already handed to the sink).
+ */
+static void retire_streamed_process(SimState* state, Process* process) {
+    metric_add(&state->waiting_metrics, process->waiting_time);
+    metric_add(&state->turnaround_metrics, process->turnaround_time);
+    metric_add(&state->response_metrics, process->response_time);
+    free(process);
+}
+
+/**
+ * @brief Frees the processes a failed streaming run still holds (queued or running).
+ *
+ * @param state A pointer to the SimState structure of a streaming run.
+ */
+static void release_streamed_processes(SimState* state) {
+    if (!state->source) return;
+    for (int c = 0; c < state->cpu_count; c++) {
+        free(state->cpus[c].running_process);
+        state->cpus[c].running_process = NULL;
+    }
+    for (int q = 0; q < state->queue_count; q++) {
+        Process* process;
+        while ((process = dequeue_process(state, q)) != NULL) free(process);
+    }
+}
+
+/**
+ * @brief Hands a process to a run queue and keeps its waiting count up to date.
+ *
+ * @param state A pointer to the SimState structure.
+ * @param queue The run queue receiving the process.
+ * @param process The process to enqueue.
+ * @param demote True when the process leaves a CPU on quantum expiry (policy_demote_process).
+ */
+static void enqueue_process(SimState* state, int queue, Process* process, bool demote) {
+    if (demote) {
+        policy_demote_process(state->queues[queue], process);
+    } else {
+        policy_add_process(state->queues[queue], process);
+    }
+    state->queued_counts[queue]++;
+}
+
+/**
+ * @brief Takes the policy's next choice out of a run queue.
+ *
+ * @param state A pointer to the SimState structure.
+ * @param queue The run queue to pick from.
+ * @return The chosen process, or NULL if the queue is empty.
+ */
+static Process* dequeue_process(SimState* state, int queue) {
+    Process* process = policy_get_next_process(state->queues[queue]);
+    if (process) state->queued_counts[queue]--;
+    return process;
+}
+
+/**
+ * @brief Lets an idle CPU pull work from the busiest other run queue.
+ *
+ * Stealing only happens with per-CPU queues, on balancing ticks. The victim's
+ * policy picks which process leaves (its next choice), and the thief pays the
+ * migration cost before running it.
+ *
+ * @param state A pointer to the SimState structure.
+ * @param thief The index of the idle CPU.
+ * @return The stolen process, or NULL if nothing could be stolen.
+ */
+static Process* steal_process(SimState* state, int thief) {
+    if (state->queue_count < 2 || state->balance_interval == 0) return NULL;
+    if (state->current_time % state->balance_interval != 0) return NULL;
+
+    int own = state->cpus[thief].queue;
+    int victim = -1;
+    for (int q = 0; q < state->queue_count; q++) {
+        if (q == own || state->queued_counts[q] == 0) continue;
+        if (victim == -1 || state->queued_counts[q] > state->queued_counts[victim]) victim = q;
+    }
+    if (victim == -1) return NULL;
+
+    Process* stolen = dequeue_process(state, victim);
+    if (!stolen) return NULL;
+
+    state->migration_count++;
+    state->cpus[thief].steals++;
+    state->cpus[thief].stall_remaining = state->migration_cost;
+    if (state->logger) {
+        logger_event(state->logger, LOG_EVENT_STEAL, state->current_time, thief, stolen->original_index, stolen->name, victim);
+    }
+    return stolen;
+}
+
+/**
+ * @brief Finds the run queue a new arrival should join.
+ *
+ * @param state A pointer to the SimState structure.
+ * @return The queue whose CPU has the fewest waiting plus running processes (lowest index on ties).
+ */
+static int least_loaded_queue(const SimState* state) {
+    int best = 0;
+    int best_load = INT_MAX;
+    for (int c = 0; c < state->cpu_count; c++) {
+        int q = state->cpus[c].queue;
+        int load = state->queued_counts[q] + (state->cpus[c].running_process != NULL);
+        if (load < best_load) {
+            best = q;
+            best_load = load;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Samples the queues and CPUs on every multiple of the telemetry stride in a run of ticks.
+ *
+ * Called once the tick's dispatch decisions are made, so a sample shows who runs
+ * during that tick. A run of quiet ticks changes none of the sampled values, so each
+ * of its stride ticks gets the same sample.
+ *
+ * @param state A pointer to the SimState structure (telemetry on).
+ * @param start_time The first tick of the run.
+ * @param ticks The number of ticks in the run.
+ */
+static void record_telemetry(SimState* state, int start_time, int ticks) {
+    long long end_time = (long long)start_time + ticks;
+    if (state->next_sample_time >= end_time) return;
+
+    TelemetrySeries* series = state->telemetry;
+    int ready_length = 0;
+    for (int q = 0; q < state->queue_count; q++) ready_length += state->queued_counts[q];
+    int arrived = state->source ? state->admitted_count : state->next_arrival_index;
+    int in_system = arrived - state->terminated_count;
+
+    for (; state->next_sample_time < end_time; state->next_sample_time += series->stride) {
+        unsigned char* busy = telemetry_append(series, (int)state->next_sample_time, ready_length, arrived, in_system);
+        if (!busy) {
+            perror("Scheduler Engine: Failed to grow the telemetry series");
+            state->stream_failed = true;
+            return;
+        }
+        for (int c = 0; c < state->cpu_count; c++) {
+            busy[c] = state->cpus[c].running_process != NULL && state->cpus[c].stall_remaining == 0;
+        }
+    }
+}
+
+/**
+ * @brief Records the current run-queue imbalance for a run of ticks.
+ *
+ * The load of a CPU is its waiting plus running processes; the imbalance is the
+ * largest load minus the smallest. Consecutive equal values share one segment.
+ *
+ * @param state A pointer to the SimState structure.
+ * @param start_time The first tick of the run.
+ * @param ticks The number of ticks the imbalance lasted.
+ */
+static void record_imbalance(SimState* state, int start_time, int ticks) {
+    if (state->queue_count < 2) return;
+
+    int min_load = INT_MAX, max_load = 0;
+    for (int c = 0; c < state->cpu_count; c++) {
+        int load = state->queued_counts[state->cpus[c].queue] + (state->cpus[c].running_process != NULL);
+        if (load < min_load) min_load = load;
+        if (load > max_load) max_load = load;
+    }
+    int imbalance = max_load - min_load;
+    state->imbalance_area += (long long)imbalance * ticks;
+    if (imbalance > state->max_imbalance) state->max_imbalance = imbalance;
+
+    if (state->imbalance_count > 0) {
+        ImbalanceSegment* last = &state->imbalance[state->imbalance_count - 1];
+        if (last->end_time == start_time && last->imbalance == imbalance) {
+            last->end_time += ticks;
+            return;
+        }
+    }
+    if (state->imbalance_count == state->imbalance_capacity) {
+        int new_capacity = state->imbalance_capacity ? state->imbalance_capacity * 2 : 64;
+        ImbalanceSegment* grown = (ImbalanceSegment*)realloc(state->imbalance, new_capacity * sizeof(ImbalanceSegment));
+        if (!grown) {
+            perror("Scheduler Engine: Failed to reallocate imbalance segments");
+            exit(EXIT_FAILURE);
+        }
+        state->imbalance = grown;
+        state->imbalance_capacity = new_capacity;
+    }
+    ImbalanceSegment* segment = &state->imbalance[state->imbalance_count++];
+    segment->start_time = start_time;
+    segment->end_time = start_time + ticks;
+    segment->imbalance = imbalance;
+}
+
+/**
+ * @brief Records a run of consecutive ticks in a CPU's Gantt chart.
+ *
+ * The run is merged into the last segment when it continues the same process;
+ * otherwise a new segment is appended. The array grows geometrically, so the
+ * number of reallocations is logarithmic in the number of segments. With a
+ * segment sink the last segment is closed instead: it is handed to the sink
+ * and its slot reused, so the chart never holds more than the open segment.
+ *
+ * @param cpu A pointer to the CPU whose timeline is extended.
+ * @param start_time The time of the first tick in the run.
+ * @param ticks The number of consecutive ticks.
+ * @param process_id The id of the process running during the run (or GANTT_IDLE_ID / GANTT_MIGRATION_ID).
+ */
+static void add_gantt_run_to_state(CpuState* cpu, int start_time, int ticks, int process_id) {
+    PROFILE_BEGIN(gantt_timer);
+    if (cpu->temp_gantt_segment_count > 0) {
+        GanttSegment* last = &cpu->temp_gantt_chart[cpu->temp_gantt_segment_count - 1];
+        if (last->end_time == start_time && last->process_id == process_id) {
+            last->end_time += ticks;
+            PROFILE_END(gantt_timer, PROFILE_PHASE_GANTT);
+            return;
+        }
+        if (cpu->sink) {
+            cpu->sink->on_segment(cpu->sink->context, cpu->id, last);
+            cpu->temp_gantt_segment_count = 0;
+        }
+    }
+
+    if (cpu->temp_gantt_segment_count == cpu->temp_gantt_capacity) {
+        int new_capacity = cpu->temp_gantt_capacity ? cpu->temp_gantt_capacity * 2 : 64;
+        GanttSegment* grown = (GanttSegment*)realloc(cpu->temp_gantt_chart, new_capacity * sizeof(GanttSegment));
+        if (!grown) {
+            perror("Scheduler Engine: Failed to reallocate Gantt chart segments");
+            exit(EXIT_FAILURE);
+        }
+        cpu->temp_gantt_chart = grown;
+        cpu->temp_gantt_capacity = new_capacity;
+    }
+
+    GanttSegment* segment = &cpu->temp_gantt_chart[cpu->temp_gantt_segment_count++];
+    segment->start_time = start_time;
+    segment->end_time = start_time + ticks;
+    segment->process_id = process_id;
+    PROFILE_END(gantt_timer, PROFILE_PHASE_GANTT);
+}
+
+/**
+ * @brief Hands a CPU's open Gantt segment to the segment sink at the end of a run.
+ *
+ * The CPU's chart is left empty, so the results keep no segments for it.
+ *
+ * @param cpu A pointer to the CPU whose timeline is complete.
+ */
+static void flush_gantt_sink(CpuState* cpu) {
+    if (!cpu->sink) return;
+    if (cpu->temp_gantt_segment_count > 0) {
+        cpu->sink->on_segment(cpu->sink->context, cpu->id, &cpu->temp_gantt_chart[0]);
+    }
+    free(cpu->temp_gantt_chart);
+    cpu->temp_gantt_chart = NULL;
+    cpu->temp_gantt_segment_count = 0;
+    cpu->temp_gantt_capacity = 0;
+}
+
+/**
+ * @brief Records a single tick in a CPU's Gantt chart.
+ *
+ * @param cpu A pointer to the CPU whose timeline is extended.
  * @param time The current simulation time for the event.
- * @param process_name The name of the process running at this time (or "IDLE").
- */
-static void add_gantt_event_to_state(SimState* state, int time, const char* process_name) {
-    state->temp_gantt_event_count++;
-    state->temp_gantt_chart = (GanttEvent*)realloc(state->temp_gantt_chart, state->temp_gantt_event_count * sizeof(GanttEvent));
-    if (!state->temp_gantt_chart) {
-        perror("Scheduler Engine: Failed to reallocate Gantt chart events");
-        exit(EXIT_FAILURE);
-    }
-    GanttEvent* new_event = &state->temp_gantt_chart[state->temp_gantt_event_count - 1];
-    new_event->time = time;
-    strncpy(new_event->process_name, process_name, sizeof(new_event->process_name) - 1);
-    new_event->process_name[sizeof(new_event->process_name) - 1] = '\0';
+ * @param process_id The id of the process running at this time (or GANTT_IDLE_ID).
+ */
+static void add_gantt_event_to_state(CpuState* cpu, int time, int process_id) {
+    add_gantt_run_to_state(cpu, time, 1, process_id);
 }
 
+/**
+ * @brief Advances the clock of every policy instance whose CPUs did work.
+ *
+ * A policy's clock moves once per tick in which at least one of the CPUs it feeds
+ * ran a process, whatever the number of such CPUs. A single tick goes through
+ * policy_tick; longer quiet windows go through policy_advance.
+ *
+ * @param state A pointer to the SimState structure.
+ * @param ticks The number of ticks the working CPUs ran for.
+ */
+static void advance_policy_clocks(SimState* state, int ticks) {
+    if (state->queue_count == 1) {
+        bool any_worked = false;
+        for (int c = 0; c < state->cpu_count; c++) {
+            any_worked |= state->cpus[c].ticked;
+            state->cpus[c].ticked = false;
+        }
+        if (!any_worked) return;
+        if (ticks == 1) policy_tick(state->queues[0]);
+        else policy_advance(state->queues[0], ticks);
+        return;
+    }
+
+    // One queue per CPU
+    for (int c = 0; c < state->cpu_count; c++) {
+        if (!state->cpus[c].ticked) continue;
+        state->cpus[c].ticked = false;
+        if (ticks == 1) policy_tick(state->queues[state->cpus[c].queue]);
+        else policy_advance(state->queues[state->cpus[c].queue], ticks);
+    }
+}
 
 /**
- * @brief Simulates a single tick of the CPU.
+ * @brief Arms the arrival timer for the next process still to arrive.
+ *
+ * Processes are in arrival order (or come from an ordered stream), so only the
+ * next arrival time is ever on the calendar.
+ *
+ * @param state A pointer to the SimState structure.
+ */
+static void arm_arrival_timer(SimState* state) {
+    if (state->source) {
+        if (state->has_pending) timer_wheel_arm(state->calendar, &state->arrival_timer, state->pending.arrival_time);
+        else timer_wheel_cancel(state->calendar, &state->arrival_timer);
+        return;
+    }
+    if (state->next_arrival_index < state->total_process_count) {
+        timer_wheel_arm(state->calendar, &state->arrival_timer, state->all_processes[state->next_arrival_index].arrival_time);
+    } else {
+        timer_wheel_cancel(state->calendar, &state->arrival_timer);
+    }
+}
+
+/**
+ * @brief Re-arms the CPU and balancing timers after a simulated tick.
+ *
+ * Each busy CPU's timer fires on the next tick that needs a decision: its process
+ * finishing (that tick is simulated normally so completion bookkeeping stays in one
+ * place), its quantum expiring, its migration stall ending or its policy's internal
+ * timer (aging, boosts). The balancing timer fires on the next tick an idle CPU may
+ * steal on, while any run queue holds work. Only event-driven runs read these timers.
+ *
+ * @param state A pointer to the SimState structure, at the tick just simulated.
+ */
+static void arm_decision_timers(SimState* state) {
+    if (!state->event_driven) return;
+    long long next_tick = (long long)state->current_time + 1;
+
+    bool any_idle = false;
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        Process* running = cpu->running_process;
+        if (running == NULL) {
+            timer_wheel_cancel(state->calendar, &cpu->timer);
+            any_idle = true;
+            continue;
+        }
+        if (cpu->stall_remaining > 0) {
+            timer_wheel_arm(state->calendar, &cpu->timer, next_tick + cpu->stall_remaining);
+            continue;
+        }
+
+        long long due = next_tick + running->remaining_burst_time - 1;
+        int quantum = policy_get_quantum(state->queues[cpu->queue], running);
+        if (quantum > 0 && next_tick + quantum - running->current_quantum_runtime < due) {
+            due = next_tick + quantum - running->current_quantum_runtime;
+        }
+        long long policy_due = next_tick + policy_ticks_until_event(state->queues[cpu->queue], running);
+        if (policy_due < due) due = policy_due;
+        timer_wheel_arm(state->calendar, &cpu->timer, (due > next_tick) ? due : next_tick);
+    }
+
+    bool work_waiting = false;
+    if (any_idle && state->queue_count > 1 && state->balance_interval > 0) {
+        for (int q = 0; q < state->queue_count; q++) {
+            if (state->queued_counts[q] > 0) work_waiting = true;
+        }
+    }
+    if (work_waiting) {
+        long long until_balance = (state->balance_interval - next_tick % state->balance_interval) % state->balance_interval;
+        timer_wheel_arm(state->calendar, &state->balance_timer, next_tick + until_balance);
+    } else {
+        timer_wheel_cancel(state->calendar, &state->balance_timer);
+    }
+}
+
+/**
+ * @brief Applies, in one step, every upcoming tick in which no decision can happen.
+ *
+ * A tick is quiet when no process arrives, no running process finishes or exhausts
+ * its quantum, no policy would preempt, no policy reports an internal timer firing,
+ * no migration stall ends and no idle CPU could steal work. Such ticks only consume
+ * CPU time, so they are accounted in bulk. Every bound of the window is a timer of
+ * the event calendar, so the window ends at its earliest expiry. The tick that ends
+ * the quiet window is left to simulate_tick.
+ *
+ * @param state A pointer to the SimState structure, positioned at the next tick to simulate.
+ */
+static void skip_quiet_ticks(SimState* state) {
+    int now = state->current_time;
+
+    // An idle CPU only stays idle if its queue had nothing to hand out
+    bool any_busy = false;
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        if (cpu->running_process == NULL) {
+            if (!cpu->last_pick_empty) return;
+            continue;
+        }
+        if (cpu->stall_remaining == 0) any_busy = true;
+    }
+
+    // Arrivals, completions, quantum expiries, stall ends, balancing ticks and policy timers
+    // are all on the calendar; with none armed, nothing can ever happen again
+    long long next_event = timer_wheel_next_expiry(state->calendar);
+    if (next_event == TIMER_WHEEL_NEVER) return;
+    long long quiet = next_event - now;
+    if (quiet <= 0) return;
+
+    if (any_busy) {
+        for (int c = 0; c < state->cpu_count; c++) {
+            CpuState* cpu = &state->cpus[c];
+            if (cpu->running_process == NULL || cpu->stall_remaining > 0) continue;
+            if (policy_needs_reschedule(state->queues[cpu->queue], cpu->running_process)) return;
+        }
+    }
+
+    PROFILE_BEGIN(quiet_timer);
+    int ticks = (int)quiet;
+    record_imbalance(state, now, ticks);
+    if (state->telemetry) record_telemetry(state, now, ticks);
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        Process* running = cpu->running_process;
+        if (running == NULL) {
+            add_gantt_run_to_state(cpu, now, ticks, GANTT_IDLE_ID);
+            continue;
+        }
+        if (cpu->stall_remaining > 0) {
+            add_gantt_run_to_state(cpu, now, ticks, GANTT_MIGRATION_ID);
+            cpu->stall_remaining -= ticks;
+            cpu->migration_time += ticks;
+            continue;
+        }
+        add_gantt_run_to_state(cpu, now, ticks, running->original_index);
+        cpu->ticked = true;
+        cpu->busy_time += ticks;
+        state->total_cpu_busy_time += ticks;
+        running->remaining_burst_time -= ticks;
+        running->current_quantum_runtime += ticks;
+        running->last_executed_time = now + ticks;
+    }
+    advance_policy_clocks(state, ticks);
+    state->current_time += ticks;
+    PROFILE_END(quiet_timer, PROFILE_PHASE_QUIET_WINDOW);
+}
+
+
+/**
+ * @brief Simulates a single tick of the CPUs.
  *
  * This function encapsulates the core logic for advancing the simulation by one time unit.
- * It handles process arrivals, quantum expiry, preemption logic, process execution,
- * and state updates.
+ * It handles process arrivals, quantum expiry, preemption logic, work stealing, process
+ * execution, and state updates. Each tick dispatches up to one process per CPU, from the
+ * shared policy or from the CPU's own run queue.
  *
  * @param state A pointer to the SimState structure to update.
  */
 static void simulate_tick(SimState* state) {
+    PROFILE_ADD(stepped_ticks, 1);
+
+    // 0. Fire the calendar's due timers (every other one is re-armed at the end of the tick)
+    timer_wheel_advance(state->calendar, state->current_time);
+    bool arrivals_due = false;
+    TimerNode* timer;
+    while ((timer = timer_wheel_pop_expired(state->calendar)) != NULL) {
+        if (timer == &state->arrival_timer) arrivals_due = true;
+    }
+
     // 1. Handle Process Arrivals
-    for (int i = 0; i < state->total_process_count; i++) {
-    if (state->all_processes[i].state == NEW && state->all_processes[i].arrival_time == state->current_time) {
-            state->all_processes[i].state = READY;
-            policy_add_process(state->active_policy_handle, &state->all_processes[i]);
-            if (state->verbose_logging) {
-                printf("Time %d: Process %s arrived.\n", state->current_time, state->all_processes[i].name);
-            }
-        }
+    if (arrivals_due) {
+        PROFILE_BEGIN(arrivals_timer);
+        admit_arrivals(state);
+        PROFILE_END(arrivals_timer, PROFILE_PHASE_ARRIVALS);
+        if (state->stream_failed) return;
     }
 
     // 2. Handle Quantum Expiry Preemption
-    if (state->running_process != NULL) {
-        int quantum = policy_get_quantum(state->active_policy_handle, state->running_process);
-        if (quantum > 0 && state->running_process->current_quantum_runtime >= quantum) {
-            if (state->verbose_logging) {
-                printf("Time %d: Process %s quantum expired. Demoting.\n", state->current_time, state->running_process->name);
+    PROFILE_BEGIN(quantum_timer);
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        if (cpu->running_process == NULL || cpu->stall_remaining > 0) continue;
+        int quantum = policy_get_quantum(state->queues[cpu->queue], cpu->running_process);
+        if (quantum > 0 && cpu->running_process->current_quantum_runtime >= quantum) {
+            if (state->logger) {
+                logger_event(state->logger, LOG_EVENT_QUANTUM_EXPIRED, state->current_time, (state->cpu_count > 1) ? c : -1,
+                             cpu->running_process->original_index, cpu->running_process->name, 0);
             }
-            policy_demote_process(state->active_policy_handle, state->running_process);
+            enqueue_process(state, cpu->queue, cpu->running_process, true);
             // CPU becomes free
-            state->running_process = NULL; 
+            cpu->running_process = NULL; 
         }
     }
+    PROFILE_END(quantum_timer, PROFILE_PHASE_QUANTUM_EXPIRY);
 
     // 3. Handle Priority-Based Preemption or Select New Process
-    bool should_reschedule = policy_needs_reschedule(state->active_policy_handle, state->running_process);
-    if (should_reschedule) {
-        Process* previously_running = state->running_process;
-        if (previously_running != NULL) {
-            previously_running->state = READY;
-            policy_add_process(state->active_policy_handle, previously_running);
+    // Every CPU decides against the current queues before any of them picks,
+    // then the CPUs that reschedule take their queue's next choices in CPU order.
+    // A CPU paying a migration stall keeps its stolen process.
+    PROFILE_BEGIN(reschedule_timer);
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        cpu->last_pick_empty = false;
+        cpu->reschedule = (cpu->stall_remaining == 0) &&
+                          policy_needs_reschedule(state->queues[cpu->queue], cpu->running_process);
+    }
+    PROFILE_END(reschedule_timer, PROFILE_PHASE_NEEDS_RESCHEDULE);
+    PROFILE_BEGIN(pick_timer);
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        if (cpu->reschedule && cpu->running_process != NULL) {
+            cpu->running_process->state = READY;
+            enqueue_process(state, cpu->queue, cpu->running_process, false);
         }
+    }
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        if (!cpu->reschedule) continue;
 
-        // Selecting the next process to run in the CPU
-        Process* next_process = policy_get_next_process(state->active_policy_handle);
-        state->running_process = next_process;
+        Process* previously_running = cpu->running_process;
 
-        if (state->running_process != previously_running && state->running_process != NULL) {
-            state->running_process->state = RUNNING;
-            state->running_process->current_quantum_runtime = 0;
+        // Selecting the next process to run on this CPU, stealing one if its own queue is empty
+        Process* next_process = dequeue_process(state, cpu->queue);
+        if (next_process == NULL) next_process = steal_process(state, c);
+        state->decisions++;
+        cpu->running_process = next_process;
+        if (next_process == NULL) cpu->last_pick_empty = true;
+
+        if (cpu->running_process != previously_running && cpu->running_process != NULL) {
+            cpu->running_process->state = RUNNING;
+            cpu->running_process->current_quantum_runtime = 0;
             
             // Setting the start_time when process first starts executing
-            if (state->running_process->start_time == 0 && state->current_time > 0) {
-                state->running_process->start_time = state->current_time;
+            if (cpu->running_process->start_time == 0 && state->current_time > 0) {
+                cpu->running_process->start_time = state->current_time;
             }
             // Setting the response_time when process first gets CPU (first time running)
-            if (state->running_process->response_time == 0) {
-                state->running_process->response_time = state->current_time - state->running_process->arrival_time;
+            if (cpu->running_process->response_time == 0) {
+                cpu->running_process->response_time = state->current_time - cpu->running_process->arrival_time;
             }
             
-            if (state->verbose_logging) {
-                printf("Time %d: Process %s starts running.\n", state->current_time, state->running_process->name);
+            if (state->logger) {
+                logger_event(state->logger, LOG_EVENT_DISPATCH, state->current_time, (state->cpu_count > 1) ? c : -1,
+                             cpu->running_process->original_index, cpu->running_process->name, 0);
             }
         }
     }
+    PROFILE_END(pick_timer, PROFILE_PHASE_GET_NEXT);
+    record_imbalance(state, state->current_time, 1);
+    if (state->telemetry) record_telemetry(state, state->current_time, 1);
+
+    // 4. Execute Tick for the Running Processes
+    PROFILE_BEGIN(execution_timer);
+    for (int c = 0; c < state->cpu_count; c++) {
+        CpuState* cpu = &state->cpus[c];
+        Process* running = cpu->running_process;
+        if (running == NULL) {
+            add_gantt_event_to_state(cpu, state->current_time, GANTT_IDLE_ID);
+            continue;
+        }
+        if (cpu->stall_remaining > 0) {
+            add_gantt_event_to_state(cpu, state->current_time, GANTT_MIGRATION_ID);
+            cpu->stall_remaining--;
+            cpu->migration_time++;
+            continue;
+        }
 
-    // 4. Execute Tick for the Running Process
-    if (state->running_process != NULL) {
-        add_gantt_event_to_state(state, state->current_time, state->running_process->name);
+        add_gantt_event_to_state(cpu, state->current_time, running->original_index);
+        cpu->busy_time++;
         state->total_cpu_busy_time++;
+        cpu->ticked = true;
         
         // Updating the process properties
-        state->running_process->remaining_burst_time--;
-        state->running_process->current_quantum_runtime++;
-        state->running_process->last_executed_time = state->current_time + 1;
-        
-        policy_tick(state->active_policy_handle);
+        running->remaining_burst_time--;
+        running->current_quantum_runtime++;
+        running->last_executed_time = state->current_time + 1;
 
         // Checking if the process has finished
-        if (state->running_process->remaining_burst_time == 0) {
-            state->running_process->state = TERMINATED;
-            state->running_process->finish_time = state->current_time + 1;
-            state->running_process->turnaround_time = state->running_process->finish_time - state->running_process->arrival_time;
-            state->running_process->waiting_time = state->running_process->turnaround_time - state->running_process->burst_time;
+        if (running->remaining_burst_time == 0) {
+            running->state = TERMINATED;
+            running->finish_time = state->current_time + 1;
+            running->turnaround_time = running->finish_time - running->arrival_time;
+            running->waiting_time = running->turnaround_time - running->burst_time;
+            if (state->waiting_column) {
+                state->waiting_column[state->terminated_count] = running->waiting_time;
+                state->turnaround_column[state->terminated_count] = running->turnaround_time;
+                state->response_column[state->terminated_count] = running->response_time;
+            }
+            latency_histogram_record(&state->results->waiting_histogram, running->waiting_time);
+            latency_histogram_record(&state->results->response_histogram, running->response_time);
+            latency_histogram_record(&state->results->turnaround_histogram, running->turnaround_time);
             state->terminated_count++;
             
-            if (state->verbose_logging) {
-                printf("Time %d: Process %s finished.\n", state->current_time + 1, state->running_process->name);
+            if (state->logger) {
+                logger_event(state->logger, LOG_EVENT_FINISH, state->current_time + 1, (state->cpu_count > 1) ? c : -1,
+                             running->original_index, running->name, 0);
             }
-            state->running_process = NULL;
+            cpu->running_process = NULL;
+            if (state->sink) state->sink->on_process(state->sink->context, running);
+            if (state->source) retire_streamed_process(state, running);
         }
-    } else {
-        add_gantt_event_to_state(state, state->current_time, "IDLE");
     }
+    PROFILE_END(execution_timer, PROFILE_PHASE_EXECUTION);
+
+    advance_policy_clocks(state, 1);
+    arm_decision_timers(state);
 }
 
 /**
  * @brief Calculates and populates final simulation metrics into the results structure.
  *
- * This function computes average turnaround time, average waiting time, and CPU utilization
- * after the simulation has completed.
+ * This function reduces the waiting, turnaround and response times of the terminated
+ * processes (the columns of a table run, or the accumulators of a streaming run) into
+ * their summaries and averages, then computes CPU utilization and the load-balancing
+ * statistics after the simulation has completed.
  *
  * @param state A pointer to the final SimState structure.
  * @param results A pointer to the SimulationResult structure to populate with metrics.
  */
 static void calculate_final_metrics(SimState* state, SimulationResult* results) {
-    float total_turnaround_time = 0;
-    float total_waiting_time = 0;
-    int actual_completed_processes = 0;
-
-    for (int i = 0; i < state->total_process_count; i++) {
-        if (state->all_processes[i].state == TERMINATED) {
-            total_turnaround_time += state->all_processes[i].turnaround_time;
-            total_waiting_time += state->all_processes[i].waiting_time;
-            actual_completed_processes++;
-        }
-    }
-
-    if (actual_completed_processes > 0) {
-        results->average_turnaround_time = total_turnaround_time / actual_completed_processes;
-        results->average_waiting_time = total_waiting_time / actual_completed_processes;
-    } else {
-        results->average_turnaround_time = 0;
-        results->average_waiting_time = 0;
+    if (state->waiting_column) {
+        size_t terminated = (size_t)state->terminated_count;
+        metric_add_column(&state->waiting_metrics, state->waiting_column, terminated, state->metrics_threads);
+        metric_add_column(&state->turnaround_metrics, state->turnaround_column, terminated, state->metrics_threads);
+        metric_add_column(&state->response_metrics, state->response_column, terminated, state->metrics_threads);
     }
+    results->waiting_summary = metric_summarize(&state->waiting_metrics);
+    results->turnaround_summary = metric_summarize(&state->turnaround_metrics);
+    results->response_summary = metric_summarize(&state->response_metrics);
+    results->average_waiting_time = (float)results->waiting_summary.mean;
+    results->average_turnaround_time = (float)results->turnaround_summary.mean;
+    results->average_response_time = (float)results->response_summary.mean;
 
     if (state->current_time > 0) {
-        results->cpu_utilization = (float)state->total_cpu_busy_time / state->current_time * 100.0f;
+        results->cpu_utilization = (float)state->total_cpu_busy_time / ((long long)state->current_time * state->cpu_count) * 100.0f;
+        results->average_imbalance = (float)state->imbalance_area / state->current_time;
     } else {
         results->cpu_utilization = 0;
+        results->average_imbalance = 0;
     }
+    results->max_imbalance = state->max_imbalance;
+    results->migration_count = state->migration_count;
 }
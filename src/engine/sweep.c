@@ -0,0 +1,216 @@
+#include "../../headers/engine/sweep.h"
+#include "../../headers/engine/workload.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+
+/**
+ * @brief A shared counter handing out work items to the pool's threads.
+ */
+typedef struct {
+    int next_index;                         /**< Next work item nobody has claimed yet. */
+    int count;                              /**< Total number of work items. */
+    pthread_mutex_t lock;                   /**< Protects next_index. */
+    void (*work)(void* context, int index); /**< Runs one work item. */
+    void* context;                          /**< Passed to every call of work. */
+} WorkPool;
+
+/**
+ * @brief Shared data of one sweep, read by the workers.
+ */
+typedef struct {
+    const SweepPlan* plan;
+    Workload** workloads;       /**< One per config, loaded in the first phase. */
+    SweepRow* rows;
+    int* row_config;            /**< Config index of each row. */
+} SweepContext;
+
+
+/**
+ * @brief Returns a monotonic timestamp in milliseconds.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Thread body: claims work items one at a time until none are left.
+ * @param arg The WorkPool.
+ * @return NULL.
+ */
+static void* pool_worker(void* arg) {
+    WorkPool* pool = (WorkPool*)arg;
+    while (1) {
+        pthread_mutex_lock(&pool->lock);
+        int index = pool->next_index++;
+        pthread_mutex_unlock(&pool->lock);
+        if (index >= pool->count) break;
+        pool->work(pool->context, index);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs count work items on up to jobs threads and waits for all of them.
+ *
+ * The calling thread takes part in the work. If a thread cannot be started,
+ * the remaining threads (at least the caller) still drain the whole pool.
+ *
+ * @param count Number of work items.
+ * @param jobs Maximum number of threads, the caller included.
+ * @param work Function running one work item.
+ * @param context Passed to every call of work.
+ */
+static void run_pool(int count, int jobs, void (*work)(void*, int), void* context) {
+    WorkPool pool;
+    pool.next_index = 0;
+    pool.count = count;
+    pool.work = work;
+    pool.context = context;
+    pthread_mutex_init(&pool.lock, NULL);
+
+    int extra = ((jobs < count) ? jobs : count) - 1;
+    pthread_t* threads = (extra > 0) ? (pthread_t*)malloc(extra * sizeof(pthread_t)) : NULL;
+    int started = 0;
+    if (threads) {
+        for (; started < extra; started++) {
+            if (pthread_create(&threads[started], NULL, pool_worker, &pool) != 0) break;
+        }
+    }
+
+    pool_worker(&pool);
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&pool.lock);
+}
+
+/**
+ * @brief Work item of the first phase: parses one config.
+ */
+static void load_workload_job(void* context, int index) {
+    SweepContext* sweep = (SweepContext*)context;
+    sweep->workloads[index] = workload_load(sweep->plan->configs[index]);
+}
+
+/**
+ * @brief Work item of the second phase: simulates one row.
+ */
+static void run_row_job(void* context, int index) {
+    SweepContext* sweep = (SweepContext*)context;
+    SweepRow* row = &sweep->rows[index];
+    const Workload* workload = sweep->workloads[sweep->row_config[index]];
+    if (!workload) return;
+
+    SimParameters params = sweep->plan->base;
+    params.config_filepath = row->config_filepath;
+    params.policy_name = row->policy_name;
+    params.quantum = row->quantum;
+    params.verbose = false;
+    params.logger = NULL;
+    params.profile = NULL;
+    params.tick_callback = NULL;
+
+    double start = now_ms();
+    SimulationResult* results = run_simulation_on(workload, &params);
+    row->run_ms = now_ms() - start;
+    if (!results) return;
+
+    row->ok = true;
+    row->average_waiting_time = results->average_waiting_time;
+    row->average_turnaround_time = results->average_turnaround_time;
+    row->p99_waiting_time = latency_histogram_percentile(&results->waiting_histogram, 99);
+    row->cpu_utilization = results->cpu_utilization;
+    row->migration_count = results->migration_count;
+    for (int i = 0; i < results->process_count; i++) {
+        if (results->processes[i].finish_time > row->makespan) row->makespan = results->processes[i].finish_time;
+    }
+    free_simulation_results(results);
+}
+
+
+/**
+ * @brief Tells whether a policy uses the time quantum (and is therefore swept over quanta).
+ * @param policy_name The policy name.
+ * @return true for quantum-based policies (rr, mlfq).
+ */
+bool policy_takes_quantum(const char* policy_name) {
+    return strcmp(policy_name, "rr") == 0 || strcmp(policy_name, "mlfq") == 0;
+}
+
+/**
+ * @brief Runs every combination of the plan on a pool of worker threads.
+ *
+ * The sweep runs in two phases: all configs are parsed in parallel, then all
+ * simulations run in parallel on the shared, read-only workloads. Policies that
+ * take no quantum are run once per config instead of once per quantum.
+ *
+ * @param plan The combinations to run.
+ * @param row_count Pointer to store the number of rows.
+ * @return A dynamically allocated array of rows (to be freed by the caller), or NULL on error.
+ */
+SweepRow* run_sweep(const SweepPlan* plan, int* row_count) {
+    *row_count = 0;
+    if (plan->config_count <= 0 || plan->policy_count <= 0) return NULL;
+
+    int jobs = plan->jobs;
+    if (jobs <= 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = (online > 0) ? (int)online : 1;
+    }
+
+    // Counting rows: quantum-based policies get one row per quantum
+    int per_config = 0;
+    for (int p = 0; p < plan->policy_count; p++) {
+        per_config += (policy_takes_quantum(plan->policies[p]) && plan->quantum_count > 0) ? plan->quantum_count : 1;
+    }
+    int total = per_config * plan->config_count;
+
+    SweepContext sweep;
+    sweep.plan = plan;
+    sweep.workloads = (Workload**)calloc(plan->config_count, sizeof(Workload*));
+    sweep.rows = (SweepRow*)calloc(total, sizeof(SweepRow));
+    sweep.row_config = (int*)malloc(total * sizeof(int));
+    if (!sweep.workloads || !sweep.rows || !sweep.row_config) {
+        perror("Sweep: Failed to allocate the sweep");
+        free(sweep.workloads);
+        free(sweep.rows);
+        free(sweep.row_config);
+        return NULL;
+    }
+
+    int n = 0;
+    for (int c = 0; c < plan->config_count; c++) {
+        for (int p = 0; p < plan->policy_count; p++) {
+            bool swept = policy_takes_quantum(plan->policies[p]) && plan->quantum_count > 0;
+            int quanta = swept ? plan->quantum_count : 1;
+            for (int q = 0; q < quanta; q++) {
+                sweep.rows[n].config_filepath = plan->configs[c];
+                sweep.rows[n].policy_name = plan->policies[p];
+                sweep.rows[n].quantum = swept ? plan->quanta[q] : 0;
+                sweep.row_config[n] = c;
+                n++;
+            }
+        }
+    }
+
+    run_pool(plan->config_count, jobs, load_workload_job, &sweep);
+    run_pool(total, jobs, run_row_job, &sweep);
+
+    for (int c = 0; c < plan->config_count; c++) {
+        workload_free(sweep.workloads[c]);
+    }
+    free(sweep.workloads);
+    free(sweep.row_config);
+
+    *row_count = total;
+    return sweep.rows;
+}
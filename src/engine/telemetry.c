@@ -0,0 +1,74 @@
+#include "../../headers/engine/telemetry.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+// Samples allocated per column when the first one is appended
+#define TELEMETRY_INITIAL_CAPACITY 1024
+
+
+TelemetrySeries* telemetry_create(int stride, int cpu_count) {
+    TelemetrySeries* series = (TelemetrySeries*)calloc(1, sizeof(TelemetrySeries));
+    if (!series) return NULL;
+    series->stride = stride;
+    series->cpu_count = cpu_count;
+    return series;
+}
+
+/**
+ * @brief Reallocates every column to a new capacity.
+ * @param series The series to grow.
+ * @param capacity The new number of samples per column.
+ * @return true OTHERWISE false (the columns already moved stay valid).
+ */
+static bool grow_columns(TelemetrySeries* series, int capacity) {
+    int** columns[] = { &series->time, &series->ready_length, &series->arrived, &series->in_system };
+    for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++) {
+        int* grown = (int*)realloc(*columns[i], (size_t)capacity * sizeof(int));
+        if (!grown) return false;
+        *columns[i] = grown;
+    }
+    unsigned char* busy = (unsigned char*)realloc(series->cpu_busy, (size_t)capacity * series->cpu_count);
+    if (!busy) return false;
+    series->cpu_busy = busy;
+    series->capacity = capacity;
+    return true;
+}
+
+bool telemetry_reserve(TelemetrySeries* series, int capacity) {
+    if (capacity <= series->capacity) return true;
+    return grow_columns(series, capacity);
+}
+
+unsigned char* telemetry_append(TelemetrySeries* series, int time, int ready_length, int arrived, int in_system) {
+    if (series->sample_count == series->capacity) {
+        int capacity = (series->capacity > 0) ? series->capacity * 2 : TELEMETRY_INITIAL_CAPACITY;
+        if (!grow_columns(series, capacity)) return NULL;
+    }
+    int i = series->sample_count++;
+    series->time[i] = time;
+    series->ready_length[i] = ready_length;
+    series->arrived[i] = arrived;
+    series->in_system[i] = in_system;
+    unsigned char* row = series->cpu_busy + (size_t)i * series->cpu_count;
+    memset(row, 0, series->cpu_count);
+    return row;
+}
+
+int telemetry_busy_cpus(const TelemetrySeries* series, int sample) {
+    const unsigned char* row = series->cpu_busy + (size_t)sample * series->cpu_count;
+    int busy = 0;
+    for (int c = 0; c < series->cpu_count; c++) busy += row[c];
+    return busy;
+}
+
+void telemetry_free(TelemetrySeries* series) {
+    if (!series) return;
+    free(series->time);
+    free(series->ready_length);
+    free(series->arrived);
+    free(series->in_system);
+    free(series->cpu_busy);
+    free(series);
+}
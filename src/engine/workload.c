@@ -0,0 +1,107 @@
+#include "../../headers/engine/workload.h"
+#include "../../headers/parser/config_parser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/**
+ * @brief Sort key used to compute the arrival order.
+ */
+typedef struct {
+    int arrival_time;
+    int id;
+} ArrivalKey;
+
+
+/**
+ * @brief Orders keys by arrival time, breaking ties with the id (config order).
+ * @param a Pointer to the first key.
+ * @param b Pointer to the second key.
+ * @return Negative if a arrives first, positive if b arrives first, zero if equal.
+ */
+static int compare_keys_by_arrival(const void* a, const void* b) {
+    const ArrivalKey* k1 = (const ArrivalKey*)a;
+    const ArrivalKey* k2 = (const ArrivalKey*)b;
+    if (k1->arrival_time != k2->arrival_time) return (k1->arrival_time < k2->arrival_time) ? -1 : 1;
+    return (k1->id > k2->id) - (k1->id < k2->id);
+}
+
+
+/**
+ * @brief Parses a configuration file into a new workload.
+ *
+ * The arrival order is computed here once, so runs only pay a linear copy.
+ *
+ * @param filepath Path to the configuration file.
+ * @return A dynamically allocated workload, or NULL on error or if no processes were found.
+ */
+Workload* workload_load(const char* filepath) {
+    int process_count = 0;
+    ParseStats parse_stats;
+    Process* processes = parse_config_file_with_stats(filepath, &process_count, &parse_stats);
+    if (!processes || process_count == 0) {
+        fprintf(stderr, "Workload: Failed to parse config file '%s' or no processes found.\n", filepath);
+        free(processes);
+        return NULL;
+    }
+
+    Workload* workload = (Workload*)malloc(sizeof(Workload));
+    int* arrival_order = (int*)malloc(process_count * sizeof(int));
+    ArrivalKey* keys = (ArrivalKey*)malloc(process_count * sizeof(ArrivalKey));
+    if (!workload || !arrival_order || !keys) {
+        perror("Workload: Failed to allocate workload");
+        free(workload);
+        free(arrival_order);
+        free(keys);
+        free(processes);
+        return NULL;
+    }
+
+    for (int i = 0; i < process_count; i++) {
+        keys[i].arrival_time = processes[i].arrival_time;
+        keys[i].id = i;
+    }
+    qsort(keys, process_count, sizeof(ArrivalKey), compare_keys_by_arrival);
+    for (int i = 0; i < process_count; i++) {
+        arrival_order[i] = keys[i].id;
+    }
+    free(keys);
+
+    workload->processes = processes;
+    workload->process_count = process_count;
+    workload->arrival_order = arrival_order;
+    workload->parse_stats = parse_stats;
+    return workload;
+}
+
+
+/**
+ * @brief Frees a workload and everything it owns.
+ * @param workload The workload to free (may be NULL).
+ */
+void workload_free(Workload* workload) {
+    if (!workload) return;
+    free(workload->processes);
+    free(workload->arrival_order);
+    free(workload);
+}
+
+
+/**
+ * @brief Copies the workload's processes in arrival order, ready to be simulated.
+ * @param workload The source workload.
+ * @return A dynamically allocated array of process_count processes, or NULL on error.
+ */
+Process* workload_copy_by_arrival(const Workload* workload) {
+    Process* copy = (Process*)malloc(workload->process_count * sizeof(Process));
+    if (!copy) {
+        perror("Workload: Failed to allocate process copy");
+        return NULL;
+    }
+    for (int i = 0; i < workload->process_count; i++) {
+        copy[i] = workload->processes[workload->arrival_order[i]];
+    }
+    return copy;
+}
@@ -16,7 +16,7 @@
 
 #include "../../headers/cli/cli.h"
 #include "../../headers/engine/scheduler_engine.h"
-#include "../../headers/parser/config_parser.h"
+#include "../../headers/engine/workload.h"
 #include "../../headers/policies/policies.h"
 
 /** @brief Main application window. */
@@ -58,8 +58,8 @@ GtkWidget *control_label;
 typedef struct {
     Process *current_processes; /**< Array of current processes being simulated. */
     int process_count;          /**< Number of processes in the simulation. */
-    GanttEvent *gantt_events;   /**< Array of events for the Gantt chart. */
-    int gantt_event_count;      /**< Number of events in the Gantt chart. */
+    GanttSegment *gantt_segments; /**< Array of run segments for the Gantt chart. */
+    int gantt_segment_count;      /**< Number of segments in the Gantt chart. */
     int current_time;           /**< Current simulation time. */
     Process *running_process;   /**< Pointer to the process currently running on the CPU. */
     bool is_running;            /**< Flag indicating if the simulation is actively running. */
@@ -74,10 +74,10 @@ typedef struct {
 SimState sim_state = {0};
 /** @brief Path to the configuration file. */
 char *config_filepath = NULL;
-/** @brief Array of processes parsed from the config file at the start. */
-Process *initial_processes = NULL;
-/** @brief Number of initial processes. */
-int initial_process_count = 0;
+/** @brief Workload parsed from the config file at the start, reused by every run. */
+Workload *workload = NULL;
+/** @brief MLFQ tuning from the --mlfq-* options (NULL for the defaults). */
+const MlfqParameters *mlfq_parameters = NULL;
 
 /**
  * @brief Structure to represent an RGB color.
@@ -386,7 +386,7 @@ void update_overall_metrics() {
  */
 gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer data) {
     // Handling initial state or no events
-    if (!sim_state.gantt_events || sim_state.gantt_event_count == 0) {
+    if (!sim_state.gantt_segments || sim_state.gantt_segment_count == 0) {
         cairo_set_source_rgb(cr, 0.95, 0.95, 0.95);
         cairo_paint(cr);
         
@@ -441,25 +441,16 @@ gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer data) {
         cairo_stroke(cr);
     }
     
-    // Drawing each process row
-    // Creating a temporary array of pointers to sort by original_index
-    Process** sorted_procs = malloc(sizeof(Process*) * sim_state.process_count);
-    for (int i=0; i<sim_state.process_count; i++) sorted_procs[i] = &sim_state.current_processes[i];
-    
-    // Performing simple bubble sort by original_index
-    for (int i=0; i<sim_state.process_count-1; i++) {
-        for (int j=0; j<sim_state.process_count-i-1; j++) {
-            if (sorted_procs[j]->original_index > sorted_procs[j+1]->original_index) {
-                Process* temp = sorted_procs[j];
-                sorted_procs[j] = sorted_procs[j+1];
-                sorted_procs[j+1] = temp;
-            }
-        }
+    // Drawing each process row in config order: the id (original_index) is the row
+    int visible_rows = sim_state.process_count < 12 ? sim_state.process_count : 12;
+    Process** procs_by_id = malloc(sizeof(Process*) * sim_state.process_count);
+    for (int i = 0; i < sim_state.process_count; i++) {
+        procs_by_id[sim_state.current_processes[i].original_index] = &sim_state.current_processes[i];
     }
 
-    for (int p = 0; p < sim_state.process_count && p < 12; p++) {
+    for (int p = 0; p < visible_rows; p++) {
         int y = top_margin + p * row_height;
-        Process* current_p = sorted_procs[p];
+        Process* current_p = procs_by_id[p];
         
         // Drawing process name with background
         Color proc_color = get_process_color(current_p->original_index); // Using index for consistent color
@@ -472,39 +463,35 @@ gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer data) {
         cairo_set_font_size(cr, 11);
         cairo_move_to(cr, 10, y + 18);
         cairo_show_text(cr, current_p->name);
-        
-        // Drawing execution timeline
-        for (int t = 0; t <= max_time; t++) {
-            bool was_running = false;
-            
-            for (int e = 0; e < sim_state.gantt_event_count; e++) {
-                int event_time = sim_state.gantt_events[e].time;
-                int next_time = (e + 1 < sim_state.gantt_event_count) ?
-                               sim_state.gantt_events[e + 1].time : 
-                               (sim_state.is_running ? sim_state.current_time + 1 : sim_state.current_time);
-                
-                if (strcmp(sim_state.gantt_events[e].process_name,
-                          current_p->name) == 0 &&
-                    t >= event_time && t < next_time) {
-                    was_running = true;
-                    break;
-                }
-            }
-            
+    }
+
+    // Drawing execution timeline, one pass over the run segments
+    for (int e = 0; e < sim_state.gantt_segment_count; e++) {
+        GanttSegment *segment = &sim_state.gantt_segments[e];
+        int id = segment->process_id;
+        if (id < 0 || id >= visible_rows) continue;
+
+        int y = top_margin + id * row_height;
+        Color proc_color = get_process_color(id);
+
+        // While running, the last segment is drawn up to the current tick
+        int end_time = (e + 1 == sim_state.gantt_segment_count && sim_state.is_running) ?
+                       segment->end_time + 1 : segment->end_time;
+        if (end_time > max_time + 1) end_time = max_time + 1;
+
+        for (int t = segment->start_time; t < end_time; t++) {
             int x = left_margin + t * time_width;
-            
-            if (was_running) {
-                // Drawing filled block with gradient effect
-                cairo_rectangle(cr, x + 3, y + 5, time_width - 6, row_height - 10);
-                cairo_set_source_rgb(cr, proc_color.r, proc_color.g, proc_color.b);
-                cairo_fill_preserve(cr);
-                cairo_set_source_rgb(cr, proc_color.r * 0.7, proc_color.g * 0.7, proc_color.b * 0.7);
-                cairo_set_line_width(cr, 1.5);
-                cairo_stroke(cr);
-            }
+
+            // Drawing filled block with gradient effect
+            cairo_rectangle(cr, x + 3, y + 5, time_width - 6, row_height - 10);
+            cairo_set_source_rgb(cr, proc_color.r, proc_color.g, proc_color.b);
+            cairo_fill_preserve(cr);
+            cairo_set_source_rgb(cr, proc_color.r * 0.7, proc_color.g * 0.7, proc_color.b * 0.7);
+            cairo_set_line_width(cr, 1.5);
+            cairo_stroke(cr);
         }
     }
-    free(sorted_procs);
+    free(procs_by_id);
     
     return FALSE;
 }
@@ -549,17 +536,17 @@ void update_displays() {
  * @param procs Array of all processes.
  * @param count Number of processes.
  * @param running Pointer to the currently running process.
- * @param events Array of Gantt chart events.
- * @param event_count Number of Gantt chart events.
+ * @param segments Array of Gantt chart segments.
+ * @param segment_count Number of Gantt chart segments.
  */
 void gui_tick_callback(int time, Process* procs, int count, Process* running,
-                       GanttEvent* events, int event_count) {
+                       GanttSegment* segments, int segment_count) {
     sim_state.current_time = time;
     sim_state.current_processes = procs;
     sim_state.process_count = count;
     sim_state.running_process = running;
-    sim_state.gantt_events = events;
-    sim_state.gantt_event_count = event_count;
+    sim_state.gantt_segments = segments;
+    sim_state.gantt_segment_count = segment_count;
     
     update_displays();
     
@@ -601,15 +588,18 @@ void start_simulation() {
     gtk_widget_set_sensitive(restart_button, TRUE);
     
     // Setting up simulation parameters
-    SimParameters sim_params;
+    SimParameters sim_params = {0};
     sim_params.config_filepath = config_filepath;
     sim_params.policy_name = sim_state.selected_policy;
     sim_params.quantum = sim_state.quantum;
     sim_params.verbose = FALSE;
     sim_params.tick_callback = gui_tick_callback;
+    sim_params.engine_mode = SIM_ENGINE_TICK;
+    sim_params.cpu_count = 1;
+    sim_params.mlfq = mlfq_parameters;
     
     // Running the simulation and storing results
-    sim_state.results = run_simulation(&sim_params);
+    sim_state.results = run_simulation_on(workload, &sim_params);
     
     // Processing and displaying final results
     if (sim_state.results) {
@@ -621,8 +611,8 @@ void start_simulation() {
         }
         sim_state.current_processes = sim_state.results->processes;
         sim_state.process_count = sim_state.results->process_count;
-        sim_state.gantt_events = sim_state.results->gantt_chart;
-        sim_state.gantt_event_count = sim_state.results->gantt_event_count;
+        sim_state.gantt_segments = sim_state.results->gantt_segments;
+        sim_state.gantt_segment_count = sim_state.results->gantt_segment_count;
         update_displays();  // Final update
     }
     
@@ -1098,20 +1088,22 @@ void create_window() {
 int main(int argc, char *argv[]) {
     CLIParams cli_params;
     if (parse_arguments(argc, argv, &cli_params) != 0) {
+        free_cli_params(&cli_params);
         return EXIT_FAILURE;
     }
     
     config_filepath = cli_params.config_filepath;
+    mlfq_parameters = cli_params.mlfq_custom ? &cli_params.mlfq : NULL;
     
-    initial_processes = parse_config_file(config_filepath, &initial_process_count);
-    if (!initial_processes) {
+    workload = workload_load(config_filepath);
+    if (!workload) {
         fprintf(stderr, "Failed to parse config file.\n");
         return EXIT_FAILURE;
     }
     
     sim_state.speed_ms = 900;
-    sim_state.current_processes = initial_processes;
-    sim_state.process_count = initial_process_count;
+    sim_state.current_processes = workload->processes;
+    sim_state.process_count = workload->process_count;
     
     gtk_init(&argc, &argv);
 
@@ -1125,9 +1117,10 @@ int main(int argc, char *argv[]) {
     
     gtk_main();
     
-    if (initial_processes) free(initial_processes);
+    workload_free(workload);
     if (sim_state.selected_policy) g_free(sim_state.selected_policy);
     if (sim_state.results) free_simulation_results(sim_state.results);
+    free_cli_params(&cli_params);
     
     return EXIT_SUCCESS;
 }
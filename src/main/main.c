@@ -2,32 +2,221 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <time.h>
 
 #include "../../headers/cli/cli.h"
 #include "../../headers/engine/scheduler_engine.h"
 #include "../../headers/output/gantt_text.h"
-#include "../../headers/parser/config_parser.h"
+#include "../../headers/engine/workload.h"
+#include "../../headers/engine/sweep.h"
+#include "../../headers/output/sweep_table.h"
+#include "../../headers/output/results_writer.h"
+#include "../../headers/output/logger.h"
+#include "../../headers/output/profile_report.h"
+#include "../../headers/policies/policies.h"
 #include "../../headers/utils/utils.h"
+#include "../../headers/parser/config_parser.h"
+#include "../../headers/parser/workload_binary.h"
+
+// Runs every config x policy x quantum combination without prompting, then prints one table
+static int run_sweep_mode(CLIParams* cli_params) {
+    char** configs = NULL;
+    char** policies = NULL;
+    char** quanta_items = NULL;
+    int* quanta = NULL;
+    int status = EXIT_FAILURE;
+
+    // Configs: -c first, then every entry of --configs
+    int config_count = 0;
+    if (cli_params->sweep_configs) {
+        char** listed = NULL;
+        int listed_count = split_comma_list(cli_params->sweep_configs, &listed);
+        if (listed_count < 0) goto cleanup;
+        configs = (char**)malloc((listed_count + 1) * sizeof(char*));
+        if (!configs) { free(listed); goto cleanup; }
+        if (cli_params->config_filepath) configs[config_count++] = cli_params->config_filepath;
+        for (int i = 0; i < listed_count; i++) configs[config_count++] = listed[i];
+        free(listed);
+    } else {
+        configs = (char**)malloc(sizeof(char*));
+        if (!configs) goto cleanup;
+        configs[config_count++] = cli_params->config_filepath;
+    }
+
+    // Policies: "all" expands to every registered policy
+    int policy_count = 0;
+    if (strcmp(cli_params->sweep_policies, "all") == 0) {
+        const char** available = get_available_policies(&policy_count);
+        policies = (char**)malloc(policy_count * sizeof(char*));
+        if (!policies) goto cleanup;
+        for (int i = 0; i < policy_count; i++) policies[i] = (char*)available[i];
+    } else {
+        policy_count = split_comma_list(cli_params->sweep_policies, &policies);
+        if (policy_count < 0) goto cleanup;
+    }
+    if (policy_count == 0) {
+        fprintf(stderr, "Error: --policies lists no policy.\n");
+        goto cleanup;
+    }
+
+    // Quanta: only used by quantum-based policies
+    int quantum_count = 1;
+    int default_quantum = 2;
+    if (cli_params->sweep_quanta) {
+        quantum_count = split_comma_list(cli_params->sweep_quanta, &quanta_items);
+        if (quantum_count < 0) goto cleanup;
+        quanta = (int*)malloc((quantum_count > 0 ? quantum_count : 1) * sizeof(int));
+        if (!quanta) goto cleanup;
+        for (int i = 0; i < quantum_count; i++) {
+            quanta[i] = atoi(quanta_items[i]);
+            if (quanta[i] <= 0) {
+                fprintf(stderr, "Error: Invalid quantum '%s'. Must be a positive integer.\n", quanta_items[i]);
+                goto cleanup;
+            }
+        }
+    }
+
+    SweepPlan plan;
+    memset(&plan, 0, sizeof(plan));
+    plan.configs = (const char**)configs;
+    plan.config_count = config_count;
+    plan.policies = (const char**)policies;
+    plan.policy_count = policy_count;
+    plan.quanta = quanta ? quanta : &default_quantum;
+    plan.quantum_count = quantum_count;
+    plan.jobs = cli_params->jobs;
+    plan.base.engine_mode = cli_params->tick_engine ? SIM_ENGINE_TICK : SIM_ENGINE_EVENT;
+    plan.base.cpu_count = cli_params->cpu_count;
+    plan.base.queue_model = cli_params->per_cpu_queues ? SIM_QUEUE_PER_CPU : SIM_QUEUE_GLOBAL;
+    plan.base.balance_interval = cli_params->balance_interval;
+    plan.base.migration_cost = cli_params->migration_cost;
+    plan.base.mlfq = cli_params->mlfq_custom ? &cli_params->mlfq : NULL;
+
+    printf("\n--> Sweeping %d config(s) x %d policies...\n\n", config_count, policy_count);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int row_count = 0;
+    SweepRow* rows = run_sweep(&plan, &row_count);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (!rows) goto cleanup;
+
+    double wall_ms = (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6;
+    print_sweep_table(rows, row_count, wall_ms);
+
+    status = EXIT_SUCCESS;
+    for (int i = 0; i < row_count; i++) {
+        if (!rows[i].ok) status = EXIT_FAILURE;
+    }
+    free(rows);
+
+cleanup:
+    free(configs);
+    free(policies);
+    free(quanta_items);
+    free(quanta);
+    return status;
+}
+
+// Writes the loaded config to --convert's file: text if it ends in ".conf", binary otherwise
+static int run_convert_mode(CLIParams* cli_params) {
+    int process_count = 0;
+    Process* processes = parse_config_file(cli_params->config_filepath, &process_count);
+    if (!processes) return EXIT_FAILURE;
+
+    const char* output = cli_params->convert_output;
+    size_t length = strlen(output);
+    bool to_text = length >= 5 && strcmp(output + length - 5, ".conf") == 0;
+
+    int status = EXIT_FAILURE;
+    if (to_text) {
+        FILE* file = fopen(output, "w");
+        if (!file) {
+            perror("Error: Could not create the converted config");
+        } else {
+            bool ok = fprintf(file, "# Converted from %s\n\n", cli_params->config_filepath) >= 0 &&
+                      write_config_text(file, processes, process_count) == 0;
+            if (fclose(file) != 0) ok = false;
+            if (ok) status = EXIT_SUCCESS;
+            else perror("Error: Failed to write the converted config");
+        }
+    } else if (write_binary_workload(output, processes, process_count) == 0) {
+        status = EXIT_SUCCESS;
+    }
+
+    if (status == EXIT_SUCCESS) {
+        printf("Converted %d processes from %s to %s (%s).\n", process_count, cli_params->config_filepath, output, to_text ? "text" : "binary");
+    }
+    free(processes);
+    return status;
+}
+
+// Prints the tail of the waiting, response and turnaround time distributions
+static void print_latency_percentiles(const SimulationResult* results) {
+    const struct { const char* label; const LatencyHistogram* histogram; } rows[] = {
+        { "Waiting Time   ", &results->waiting_histogram },
+        { "Response Time  ", &results->response_histogram },
+        { "Turnaround Time", &results->turnaround_histogram },
+    };
+    printf("\n⏱️  Latency Percentiles (p50 / p90 / p99 / p99.9 / max):\n");
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        LatencyPercentiles p = latency_histogram_percentiles(rows[i].histogram);
+        printf("   - %s         : %d / %d / %d / %d / %d units\n", rows[i].label, p.p50, p.p90, p.p99, p.p999, p.max);
+    }
+}
 
 int main(int argc, char* argv[]) {
     // 1. Parse command-line arguments
     CLIParams cli_params;
     if (parse_arguments(argc, argv, &cli_params) != 0) {
+        free_cli_params(&cli_params);
         return EXIT_FAILURE;
     }
 
+    if (cli_params.decode_log) {
+        FILE* log = fopen(cli_params.decode_log, "rb");
+        if (!log) perror("Error: Could not open the log");
+        long long decoded = log ? log_decode_file(log, stdout) : -1;
+        if (log) fclose(log);
+        free_cli_params(&cli_params);
+        return (decoded >= 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (cli_params.convert_output) {
+        int status = run_convert_mode(&cli_params);
+        free_cli_params(&cli_params);
+        return status;
+    }
+
     printf("╔═══════════════════════════════════════════════════╗\n");
     printf("║       Linux Multi-Tasks Scheduler Simulator       ║\n");
     printf("╚═══════════════════════════════════════════════════╝\n");
 
-    // 1.5 Parse and display processes
-    int process_count = 0;
-    Process* processes = parse_config_file(cli_params.config_filepath, &process_count);
+    if (cli_params.sweep) {
+        int status = run_sweep_mode(&cli_params);
+        free_cli_params(&cli_params);
+        return status;
+    }
+
+    // 1.5 Parse the workload once and display processes (streamed configs are read during the run)
+    EngineProfile profile = { 0 };
+    long long stage_start = profile_clock_ns();
+    Workload* workload = cli_params.stream ? NULL : workload_load(cli_params.config_filepath);
+    profile.stage_ns[PROFILE_STAGE_PARSE] = profile_clock_ns() - stage_start;
     
-    if (processes) {
-        print_process_table(processes, process_count);
-        free(processes);
+    if (cli_params.stream) {
+        printf("Streaming processes from %s as they arrive.\n", cli_params.config_filepath);
+    } else if (workload) {
+        print_process_table(workload->processes, workload->process_count);
+        const ParseStats* stats = &workload->parse_stats;
+        double megabytes = stats->bytes / (1024.0 * 1024.0);
+        printf("Parsed %.2f MB in %.2f ms", megabytes, stats->seconds * 1000.0);
+        if (stats->seconds > 0) printf(" (%.1f MB/s)", megabytes / stats->seconds);
+        printf(", %s, %s", stats->binary ? "binary" : "text", stats->mapped ? "memory-mapped" : "read into memory");
+        if (!stats->binary) printf(", %d thread%s", stats->threads, stats->threads > 1 ? "s" : "");
+        printf("\n");
     } else {
+        free_cli_params(&cli_params);
         return EXIT_FAILURE;
     }
 
@@ -35,6 +224,8 @@ int main(int argc, char* argv[]) {
     char* selected_policy = NULL;
     if (!get_policy_input(&selected_policy)) {
         // Error message already printed by get_policy_input
+        workload_free(workload);
+        free_cli_params(&cli_params);
         return EXIT_FAILURE;
     }
 
@@ -46,6 +237,8 @@ int main(int argc, char* argv[]) {
         if (scanf("%d", &quantum) != 1 || quantum <= 0) {
             fprintf(stderr, "Error: Invalid quantum value. Must be a positive integer.\n");
             free(selected_policy);
+            workload_free(workload);
+            free_cli_params(&cli_params);
             return EXIT_FAILURE;
         }
         int c;
@@ -53,45 +246,163 @@ int main(int argc, char* argv[]) {
     }
 
     // 4. Configure Simulation Parameters
-    SimParameters sim_params;
+    SimParameters sim_params = {0};
     sim_params.config_filepath = cli_params.config_filepath;
     sim_params.policy_name = selected_policy;
     sim_params.quantum = quantum;
     sim_params.verbose = cli_params.verbose;
     sim_params.tick_callback = NULL;
+    sim_params.engine_mode = cli_params.tick_engine ? SIM_ENGINE_TICK : SIM_ENGINE_EVENT;
+    sim_params.cpu_count = cli_params.cpu_count;
+    sim_params.queue_model = cli_params.per_cpu_queues ? SIM_QUEUE_PER_CPU : SIM_QUEUE_GLOBAL;
+    sim_params.balance_interval = cli_params.balance_interval;
+    sim_params.migration_cost = cli_params.migration_cost;
+    sim_params.mlfq = cli_params.mlfq_custom ? &cli_params.mlfq : NULL;
+    sim_params.sink = NULL;
+    sim_params.telemetry_stride = cli_params.telemetry_output ? cli_params.telemetry_stride : 0;
+    sim_params.profile = cli_params.profile ? &profile : NULL;
+    // --jobs also bounds the threads reducing the final metrics (at most one per million processes)
+    long online_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    sim_params.metrics_threads = (cli_params.jobs > 0) ? cli_params.jobs : (online_cpus > 0 ? (int)online_cpus : 1);
+
+    // Results written as they complete: CSV if the name ends in ".csv", binary otherwise
+    ResultsSink* results_sink = NULL;
+    if (cli_params.results_output) {
+        const char* output = cli_params.results_output;
+        size_t length = strlen(output);
+        bool to_csv = length >= 4 && strcmp(output + length - 4, ".csv") == 0;
+        results_sink = results_writer_open(output, to_csv ? RESULTS_FORMAT_CSV : RESULTS_FORMAT_BINARY);
+        if (!results_sink) {
+            free(selected_policy);
+            workload_free(workload);
+            free_cli_params(&cli_params);
+            return EXIT_FAILURE;
+        }
+        sim_params.sink = results_sink;
+    }
+
+    // Scheduling events: binary records in --log's file, else text on stdout with --verbose
+    FILE* log_file = NULL;
+    Logger* logger = NULL;
+    if (cli_params.log_output) {
+        log_file = fopen(cli_params.log_output, "wb");
+        if (!log_file) perror("Error: Could not create the log file");
+        logger = log_file ? logger_open(log_file, LOG_FORMAT_BINARY, 0) : NULL;
+        if (!logger) {
+            if (log_file) fclose(log_file);
+            results_writer_close(results_sink);
+            free(selected_policy);
+            workload_free(workload);
+            free_cli_params(&cli_params);
+            return EXIT_FAILURE;
+        }
+    } else if (cli_params.verbose) {
+        logger = logger_open(stdout, LOG_FORMAT_TEXT, 0);
+    }
+    if (logger) {
+        logger_set_level(logger, cli_params.log_level);
+        logger_set_categories(logger, cli_params.log_categories);
+    }
+    sim_params.logger = logger;
     
     printf("\n");
     printf("--> Starting Simulation...\n");
     printf("    Config : %s\n", sim_params.config_filepath);
     printf("    Policy : %s\n", sim_params.policy_name);
     if (quantum > 0) printf("    Quantum: %d\n", sim_params.quantum);
+    if (sim_params.cpu_count > 1) printf("    CPUs   : %d\n", sim_params.cpu_count);
+    if (sim_params.queue_model == SIM_QUEUE_PER_CPU) {
+        printf("    Queues : per CPU (balance every %d, migration cost %d)\n", sim_params.balance_interval, sim_params.migration_cost);
+    }
+    if (sim_params.mlfq && strcmp(selected_policy, "mlfq") == 0) {
+        const MlfqParameters* mlfq = sim_params.mlfq;
+        if (mlfq->level_count) printf("    MLFQ   : %d levels", mlfq->level_count);
+        else printf("    MLFQ   : default levels");
+        if (mlfq->quanta_count) printf(", %d quanta", mlfq->quanta_count);
+        if (mlfq->allotment_count) printf(", %d allotments", mlfq->allotment_count);
+        if (mlfq->aging_threshold < 0) printf(", no aging");
+        else if (mlfq->aging_threshold > 0) printf(", aging after %d", mlfq->aging_threshold);
+        if (mlfq->boost_period > 0) printf(", boost every %d", mlfq->boost_period);
+        printf("\n");
+    }
     printf("-----------------------------------------------------\n\n");
 
     // 5. Run Simulation
-    SimulationResult* results = run_simulation(&sim_params);
+    stage_start = profile_clock_ns();
+    SimulationResult* results = cli_params.stream ? run_simulation_streamed(&sim_params)
+                                                  : run_simulation_on(workload, &sim_params);
+    profile.stage_ns[PROFILE_STAGE_SIMULATE] = profile_clock_ns() - stage_start;
+    int sink_status = results_writer_close(results_sink);
+    if (logger_close(logger) != 0) sink_status = -1;
+    if (log_file && fclose(log_file) != 0) {
+        perror("Error: Failed to write the log file");
+        sink_status = -1;
+    }
 
-    if (results == NULL) {
-        fprintf(stderr, "❌ Simulation failed to run (returned NULL).\n");
+    if (results == NULL || sink_status != 0) {
+        if (results == NULL) fprintf(stderr, "❌ Simulation failed to run (returned NULL).\n");
+        free_simulation_results(results);
         free(selected_policy);
+        workload_free(workload);
+        free_cli_params(&cli_params);
         return EXIT_FAILURE;
     }
 
     // 6. Display Results
+    stage_start = profile_clock_ns();
     printf("✅ Simulation Completed!\n\n");
     printf("📊 Performance Metrics:\n");
     printf("   - Average Waiting Time    : %.2f units\n", results->average_waiting_time);
     printf("   - Average Turnaround Time : %.2f units\n", results->average_turnaround_time);
+    printf("   - Average Response Time   : %.2f units\n", results->average_response_time);
     printf("   - CPU Utilization         : %.2f %%\n", results->cpu_utilization);
+    if (cli_params.stream) {
+        printf("   - Processes               : %d (at most %d resident)\n", results->process_count, results->peak_resident_processes);
+    }
+    if (results->cpu_count > 1) {
+        for (int c = 0; c < results->cpu_count; c++) {
+            printf("       CPU %-3d               : %.2f %%", c, results->cpu_lanes[c].utilization);
+            if (sim_params.queue_model == SIM_QUEUE_PER_CPU) {
+                printf("  (%d steals, %lld migration ticks)", results->cpu_lanes[c].steals, results->cpu_lanes[c].migration_time);
+            }
+            printf("\n");
+        }
+    }
+    if (sim_params.queue_model == SIM_QUEUE_PER_CPU) {
+        printf("   - Migrations              : %d\n", results->migration_count);
+        printf("   - Run-Queue Imbalance     : %.2f avg, %d max\n", results->average_imbalance, results->max_imbalance);
+    }
+    print_latency_percentiles(results);
     
-    // Display Gantt chart
-    if (results->gantt_chart) {
+    if (cli_params.results_output) {
+        printf("   - Results written to      : %s\n", cli_params.results_output);
+    }
+    if (cli_params.log_output) {
+        printf("   - Events logged to        : %s (decode with --decode-log)\n", cli_params.log_output);
+    }
+    if (cli_params.telemetry_output && results->telemetry) {
+        if (write_telemetry_csv(cli_params.telemetry_output, results->telemetry) == 0) {
+            printf("   - Telemetry written to    : %s (%d samples, every %d ticks)\n",
+                   cli_params.telemetry_output, results->telemetry->sample_count, results->telemetry->stride);
+        }
+    }
+
+    // Display Gantt chart (streamed runs keep no process table to draw it from)
+    if (results->gantt_segments && results->processes) {
         printf("\n📈 Gantt Chart:\n");
         print_gantt_chart(results);
     }
+    if (cli_params.profile) {
+        fflush(stdout);
+        profile.stage_ns[PROFILE_STAGE_RENDER] = profile_clock_ns() - stage_start;
+        print_profile_report(&profile);
+    }
 
     // 7. Cleanup
     free_simulation_results(results);
     free(selected_policy);
+    workload_free(workload);
+    free_cli_params(&cli_params);
 
     return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include <ncurses.h>
 #include "../../headers/cli/cli.h"
 #include "../../headers/engine/scheduler_engine.h"
-#include "../../headers/parser/config_parser.h"
+#include "../../headers/engine/workload.h"
 
 // Window pointers for different panels
 WINDOW *title_win;
@@ -193,7 +193,7 @@ void draw_status(Process* running, Process* all_procs, int count) {
     wrefresh(status_win);
 }
 // Draw Gantt chart with all processes as rows
-void draw_gantt_chart(GanttEvent* events, int event_count, Process* all_procs, 
+void draw_gantt_chart(GanttSegment* segments, int segment_count, Process* all_procs, 
                       int proc_count, int current_time, bool is_final) {
     werase(gantt_win);
     box(gantt_win, 0, 0);
@@ -223,24 +223,18 @@ void draw_gantt_chart(GanttEvent* events, int event_count, Process* all_procs,
             mvwprintw(gantt_win, 2, time_offset + 6 + display_pos * time_width, "---");
         }
     }
-    // Draw each process as a row using original_index and sorting
-    // Create temp array
-    Process** sorted_procs = malloc(sizeof(Process*) * proc_count);
-    for (int i=0; i<proc_count; i++) sorted_procs[i] = &all_procs[i];
-    
-    // Sort
-    for (int i=0; i<proc_count-1; i++) {
-        for (int j=0; j<proc_count-i-1; j++) {
-            if (sorted_procs[j]->original_index > sorted_procs[j+1]->original_index) {
-                Process* temp = sorted_procs[j];
-                sorted_procs[j] = sorted_procs[j+1];
-                sorted_procs[j+1] = temp;
-            }
-        }
-    }
-    for (int p = 0; p < proc_count && p < 14; p++) {  // Limit to available height
+    // Draw each process as a row in config order: the id (original_index) is the row
+    int visible_rows = proc_count < 14 ? proc_count : 14;  // Limit to available height
+    Process** procs_by_id = malloc(sizeof(Process*) * proc_count);
+    for (int i = 0; i < proc_count; i++) procs_by_id[all_procs[i].original_index] = &all_procs[i];
+
+    int first_t = tui_state.gantt_offset;
+    int last_t = display_end + tui_state.gantt_offset;
+    if (last_t > current_time) last_t = current_time;
+
+    for (int p = 0; p < visible_rows; p++) {
         int row = 3 + p;
-        Process* current_p = sorted_procs[p];
+        Process* current_p = procs_by_id[p];
         
         // Process name
         int color = COLOR_PAIR(0);
@@ -252,33 +246,31 @@ void draw_gantt_chart(GanttEvent* events, int event_count, Process* all_procs,
         mvwprintw(gantt_win, row, 2, "%-8s |", current_p->name);
         wattroff(gantt_win, color);
         
-        // Draw execution timeline for this process
-        for (int t = tui_state.gantt_offset; t <= display_end + tui_state.gantt_offset && t <= current_time; t++) {
+        // Draw the empty timeline for this process
+        for (int t = first_t; t <= last_t; t++) {
             int display_pos = t - tui_state.gantt_offset;
             if (display_pos < 0 || display_pos > max_display_time) continue;
-            // Check if this process was running at time t
-            bool was_running = false;
-            
-            for (int e = 0; e < event_count; e++) {
-                int event_time = events[e].time;
-                int next_time = (e + 1 < event_count) ? events[e + 1].time : (is_final ? current_time : current_time + 1);
-                                if (strcmp(events[e].process_name, current_p->name) == 0 &&
-                    t >= event_time && t < next_time) {
-                    was_running = true;
-                    break;
-                }
-            }
-            
-            if (was_running) {
-                wattron(gantt_win, COLOR_PAIR(1));
-                mvwprintw(gantt_win, row, time_offset + 6 + display_pos * time_width, " # ");
-                wattroff(gantt_win, COLOR_PAIR(1));
-            } else {
-                mvwprintw(gantt_win, row, time_offset + 6 + display_pos * time_width, " . ");
-            }
+            mvwprintw(gantt_win, row, time_offset + 6 + display_pos * time_width, " . ");
         }
     }
-    free(sorted_procs);
+
+    // Paint the visible part of every segment on its process row (single pass)
+    wattron(gantt_win, COLOR_PAIR(1));
+    for (int s = 0; s < segment_count; s++) {
+        int id = segments[s].process_id;
+        if (id < 0 || id >= visible_rows) continue;
+        // While live, the last run is drawn up to the current tick
+        int seg_end = (s + 1 == segment_count && !is_final) ? segments[s].end_time + 1 : segments[s].end_time;
+        int from = segments[s].start_time > first_t ? segments[s].start_time : first_t;
+        int to = seg_end - 1 < last_t ? seg_end - 1 : last_t;
+        for (int t = from; t <= to; t++) {
+            int display_pos = t - tui_state.gantt_offset;
+            if (display_pos < 0 || display_pos > max_display_time) continue;
+            mvwprintw(gantt_win, 3 + id, time_offset + 6 + display_pos * time_width, " # ");
+        }
+    }
+    wattroff(gantt_win, COLOR_PAIR(1));
+    free(procs_by_id);
     
     wrefresh(gantt_win);
 }
@@ -417,14 +409,14 @@ int main(int argc, char* argv[]) {
     // Parse arguments (reuse CLI parser)
     CLIParams cli_params;
     if (parse_arguments(argc, argv, &cli_params) != 0) {
+        free_cli_params(&cli_params);
         return EXIT_FAILURE;
     }
     
-    // Parse config file
-    int process_count = 0;
-    Process* processes = parse_config_file(cli_params.config_filepath, &process_count);
+    // Parse config file once; every run and restart reuses this workload
+    Workload* workload = workload_load(cli_params.config_filepath);
     
-    if (!processes) {
+    if (!workload) {
         fprintf(stderr, "Failed to parse config file.\n");
         return EXIT_FAILURE;
     }
@@ -432,7 +424,7 @@ int main(int argc, char* argv[]) {
     // Get policy selection
     char* selected_policy = NULL;
     if (!get_policy_input(&selected_policy)) {
-        free(processes);
+        workload_free(workload);
         return EXIT_FAILURE;
     }
     
@@ -455,19 +447,9 @@ int main(int argc, char* argv[]) {
         tui_state.paused = false;  // Ensure not paused on restart
         tui_state.gantt_offset = 0;
         
-        // Reload processes from config file for fresh simulation
-        int fresh_process_count = 0;
-        Process* fresh_processes = parse_config_file(cli_params.config_filepath, &fresh_process_count);
-        
-        if (!fresh_processes) {
-            cleanup_tui();
-            fprintf(stderr, "Failed to reload config file.\\n");
-            return EXIT_FAILURE;
-        }
-        
         // Live update callback for TUI
         void tui_tick_callback(int time, Process* procs, int count, Process* running, 
-                               GanttEvent* events, int event_count) {
+                               GanttSegment* segments, int segment_count) {
             // Handle user input
             handle_input();
             
@@ -508,7 +490,7 @@ int main(int argc, char* argv[]) {
             draw_title(selected_policy, time);
             draw_process_info(procs, count);
             draw_status(running, procs, count);
-            draw_gantt_chart(events, event_count, procs, count, time, false);
+            draw_gantt_chart(segments, segment_count, procs, count, time, false);
             draw_performance_metrics(procs, count);
             draw_overall_metrics(avg_wait, avg_turnaround, cpu_util);
             draw_controls();
@@ -522,15 +504,18 @@ int main(int argc, char* argv[]) {
         }
         
         // Configure simulation parameters
-        SimParameters sim_params;
+        SimParameters sim_params = {0};
         sim_params.config_filepath = cli_params.config_filepath;
         sim_params.policy_name = selected_policy;
         sim_params.quantum = quantum;
         sim_params.verbose = false;  // Don't print logs to stdout
         sim_params.tick_callback = tui_tick_callback;
+        sim_params.engine_mode = SIM_ENGINE_TICK;
+        sim_params.cpu_count = 1;
+        sim_params.mlfq = cli_params.mlfq_custom ? &cli_params.mlfq : NULL;
         
         // Run simulation with live updates
-        SimulationResult* results = run_simulation(&sim_params);
+        SimulationResult* results = run_simulation_on(workload, &sim_params);
         
         // Show final results
         if (results && !tui_state.should_quit && !tui_state.should_restart) {
@@ -544,7 +529,7 @@ int main(int argc, char* argv[]) {
             draw_title(selected_policy, final_time);
             draw_process_info(results->processes, results->process_count);
             draw_status(NULL, results->processes, results->process_count);
-            draw_gantt_chart(results->gantt_chart, results->gantt_event_count,
+            draw_gantt_chart(results->gantt_segments, results->gantt_segment_count,
                              results->processes, results->process_count, final_time, true);
             draw_performance_metrics(results->processes, results->process_count);
             draw_overall_metrics(results->average_waiting_time,
@@ -570,12 +555,12 @@ int main(int argc, char* argv[]) {
                     break;
                 } else if (ch == KEY_RIGHT) {
                     tui_state.gantt_offset += 5;
-                    draw_gantt_chart(results->gantt_chart, results->gantt_event_count,
+                    draw_gantt_chart(results->gantt_segments, results->gantt_segment_count,
                              results->processes, results->process_count, final_time, true);
                 } else if (ch == KEY_LEFT) {
                     if (tui_state.gantt_offset >= 5) tui_state.gantt_offset -= 5;
                     else tui_state.gantt_offset = 0;
-                     draw_gantt_chart(results->gantt_chart, results->gantt_event_count,
+                     draw_gantt_chart(results->gantt_segments, results->gantt_segment_count,
                              results->processes, results->process_count, final_time, true);
                 } else if (ch == KEY_RESIZE) {
                      cleanup_tui();
@@ -583,7 +568,7 @@ int main(int argc, char* argv[]) {
                      draw_title(selected_policy, final_time);
                      draw_process_info(results->processes, results->process_count);
                      draw_status(NULL, results->processes, results->process_count);
-                     draw_gantt_chart(results->gantt_chart, results->gantt_event_count,
+                     draw_gantt_chart(results->gantt_segments, results->gantt_segment_count,
                                       results->processes, results->process_count, final_time, true);
                      draw_performance_metrics(results->processes, results->process_count);
                      draw_overall_metrics(results->average_waiting_time,
@@ -604,14 +589,14 @@ int main(int argc, char* argv[]) {
         if (results) {
             free_simulation_results(results);
         }
-        free(fresh_processes);
         
     } while (tui_state.should_restart && !tui_state.should_quit);
     
     // Cleanup
     cleanup_tui();
-    free(processes);
+    workload_free(workload);
     free(selected_policy);
+    free_cli_params(&cli_params);
     
     printf("\nTUI Scheduler terminated.\n");
     return EXIT_SUCCESS;
@@ -3,18 +3,14 @@
 #include <string.h>
 #include "../../headers/output/gantt_text.h"
 
-// Helper to find the index of a process in the processes array by name
-static int get_process_index(const char* name, Process* processes, int count) {
-    for (int i = 0; i < count; i++) {
-        if (strcmp(processes[i].name, name) == 0) {
-            return i;
-        }
-    }
-    return -1;
+// Helper to map a process id to its row (its index in the processes array)
+static int get_process_index(const SimulationResult* results, int process_id) {
+    if (process_id < 0 || process_id >= results->process_count) return -1;
+    return (int)(results->process_by_id[process_id] - results->processes);
 }
 
 void print_gantt_chart(const SimulationResult* results) {
-    if (!results || !results->gantt_chart || results->gantt_event_count == 0 || results->process_count == 0) {
+    if (!results || !results->processes || !results->gantt_segments || results->gantt_segment_count == 0 || results->process_count == 0) {
         printf("No Gantt chart data available.\n");
         return;
     }
@@ -27,30 +23,33 @@ void print_gantt_chart(const SimulationResult* results) {
         }
     }
     
-    // Fallback if finishes not populated properly but events exist
-    if (total_time == 0 && results->gantt_event_count > 0) {
-        total_time = results->gantt_chart[results->gantt_event_count - 1].time;
+    // Fallback if finishes not populated properly but segments exist
+    if (total_time == 0) {
+        total_time = results->gantt_segments[results->gantt_segment_count - 1].end_time;
     }
 
-    // 2. Prepare grid
-    char* grid = (char*)calloc(results->process_count * total_time, sizeof(char));
+    // 2. Prepare grid (size_t: a large run has more cells than an int can count)
+    int* grid = (int*)calloc((size_t)results->process_count * (size_t)total_time, sizeof(int));
     if (!grid) {
         fprintf(stderr, "Memory allocation failed for Gantt grid.\n");
         return;
     }
 
-    // 3. Fill grid
-    for (int i = 0; i < results->gantt_event_count; i++) {
-        int start_t = results->gantt_chart[i].time;
-        int end_t = (i + 1 < results->gantt_event_count) ? results->gantt_chart[i+1].time : total_time;
-        char* p_name = results->gantt_chart[i].process_name;
-        
-        int p_idx = get_process_index(p_name, results->processes, results->process_count);
-        
-        if (p_idx != -1 && start_t < total_time) {
-             for (int t = start_t; t < end_t && t < total_time; t++) {
-                grid[p_idx * total_time + t] = 1;
-             }
+    // 3. Fill grid (one pass per segment of every CPU lane); a cell holds 1 + the CPU that ran it
+    int lane_count = results->cpu_lanes ? results->cpu_count : 1;
+    for (int c = 0; c < lane_count; c++) {
+        const GanttSegment* segments = results->cpu_lanes ? results->cpu_lanes[c].segments : results->gantt_segments;
+        int segment_count = results->cpu_lanes ? results->cpu_lanes[c].segment_count : results->gantt_segment_count;
+        for (int i = 0; i < segment_count; i++) {
+            int start_t = segments[i].start_time;
+            int end_t = segments[i].end_time;
+            int p_idx = get_process_index(results, segments[i].process_id);
+            
+            if (p_idx != -1 && start_t < total_time) {
+                 for (int t = start_t; t < end_t && t < total_time; t++) {
+                    grid[(size_t)p_idx * total_time + t] = c + 1;
+                 }
+            }
         }
     }
 
@@ -82,7 +81,9 @@ void print_gantt_chart(const SimulationResult* results) {
         for (int t = 0; t < total_time; t++) {
             printf("|");
             
-            if (grid[p * total_time + t]) {
+            if (grid[(size_t)p * total_time + t] && lane_count > 1) {
+                printf("%2d", (grid[(size_t)p * total_time + t] - 1) % 100); // CPU number
+            } else if (grid[(size_t)p * total_time + t]) {
                 printf("██"); 
             } else {
                 printf("  ");
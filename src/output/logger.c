@@ -0,0 +1,377 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "../../headers/output/logger.h"
+
+// Longest wait of the flush thread before it looks at the ring again
+#define LOG_FLUSH_PERIOD_NS 2000000L
+
+// Longest decoded line, and the batch of lines handed to the output at once
+#define LOG_LINE_MAX 128
+#define LOG_TEXT_CHUNK (64 * 1024)
+
+// The state behind a logger: a single-producer, single-consumer ring of records
+struct Logger {
+    LogRecord* ring;
+    size_t mask;                // Capacity - 1 (the capacity is a power of two)
+    atomic_size_t head;         // Next slot the producer fills
+    atomic_size_t tail;         // Next slot the flush thread drains
+    atomic_int level;           // Lowest LogLevel kept
+    atomic_uint categories;     // LogCategory mask kept
+    atomic_bool closing;        // Set by logger_close: drain and exit
+    FILE* output;
+    LogFormat format;
+    bool failed;                // Set by the flush thread once a write failed
+    pthread_mutex_t lock;       // Guards the two conditions below
+    pthread_cond_t wake;        // Signaled when there is work for the flush thread
+    pthread_cond_t drained;     // Broadcast each time the flush thread caught up
+    pthread_t thread;
+};
+
+// Level and category of each event
+static const struct {
+    LogLevel level;
+    LogCategory category;
+} EVENT_CLASSES[LOG_EVENT_COUNT] = {
+    [LOG_EVENT_ARRIVAL]         = { LOG_LEVEL_INFO,  LOG_CATEGORY_ARRIVAL },
+    [LOG_EVENT_DISPATCH]        = { LOG_LEVEL_DEBUG, LOG_CATEGORY_DISPATCH },
+    [LOG_EVENT_QUANTUM_EXPIRED] = { LOG_LEVEL_DEBUG, LOG_CATEGORY_PREEMPTION },
+    [LOG_EVENT_FINISH]          = { LOG_LEVEL_INFO,  LOG_CATEGORY_TERMINATION },
+    [LOG_EVENT_STEAL]           = { LOG_LEVEL_INFO,  LOG_CATEGORY_MIGRATION },
+};
+
+static const char* LEVEL_NAMES[] = { "debug", "info", "warn", "error" };
+
+static const struct {
+    const char* name;
+    unsigned mask;
+} CATEGORY_NAMES[] = {
+    { "arrival", LOG_CATEGORY_ARRIVAL },
+    { "dispatch", LOG_CATEGORY_DISPATCH },
+    { "preemption", LOG_CATEGORY_PREEMPTION },
+    { "termination", LOG_CATEGORY_TERMINATION },
+    { "migration", LOG_CATEGORY_MIGRATION },
+    { "all", LOG_CATEGORY_ALL },
+};
+
+
+// Writes records [from, to) of the ring to the output
+static void write_records(Logger* logger, size_t from, size_t to) {
+    if (logger->format == LOG_FORMAT_BINARY) {
+        while (from < to && !logger->failed) {
+            // Contiguous up to the end of the ring
+            size_t count = to - from;
+            size_t until_wrap = logger->mask + 1 - (from & logger->mask);
+            if (count > until_wrap) count = until_wrap;
+            if (fwrite(&logger->ring[from & logger->mask], sizeof(LogRecord), count, logger->output) != count) logger->failed = true;
+            from += count;
+        }
+        return;
+    }
+
+    // Text: lines are batched so the output stream is locked once per chunk, not per line
+    char chunk[LOG_TEXT_CHUNK];
+    size_t used = 0;
+    for (; from < to && !logger->failed; from++) {
+        if (used > sizeof(chunk) - LOG_LINE_MAX) {
+            if (fwrite(chunk, 1, used, logger->output) != used) logger->failed = true;
+            used = 0;
+        }
+        used += log_record_format(&logger->ring[from & logger->mask], chunk + used, LOG_LINE_MAX - 1);
+        chunk[used++] = '\n';
+    }
+    if (used > 0 && fwrite(chunk, 1, used, logger->output) != used) logger->failed = true;
+}
+
+// Flush thread: drains the ring whenever woken (or periodically) until the logger closes
+static void* flush_thread(void* arg) {
+    Logger* logger = (Logger*)arg;
+    while (1) {
+        size_t tail = atomic_load_explicit(&logger->tail, memory_order_relaxed);
+        size_t head = atomic_load_explicit(&logger->head, memory_order_acquire);
+        if (head != tail) {
+            write_records(logger, tail, head);
+            atomic_store_explicit(&logger->tail, head, memory_order_release);
+            continue;
+        }
+
+        // Caught up: tell the waiters, then sleep until there is more
+        if (fflush(logger->output) != 0) logger->failed = true;
+        pthread_mutex_lock(&logger->lock);
+        pthread_cond_broadcast(&logger->drained);
+        if (atomic_load(&logger->closing) && atomic_load(&logger->head) == head) {
+            pthread_mutex_unlock(&logger->lock);
+            break;
+        }
+        if (atomic_load(&logger->head) == head) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += LOG_FLUSH_PERIOD_NS;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&logger->wake, &logger->lock, &deadline);
+        }
+        pthread_mutex_unlock(&logger->lock);
+    }
+    return NULL;
+}
+
+
+Logger* logger_open(FILE* output, LogFormat format, size_t capacity) {
+    size_t rounded = 1;
+    while (rounded < ((capacity > 0) ? capacity : LOG_DEFAULT_CAPACITY)) rounded *= 2;
+
+    Logger* logger = (Logger*)calloc(1, sizeof(Logger));
+    LogRecord* ring = (LogRecord*)malloc(rounded * sizeof(LogRecord));
+    if (!logger || !ring) {
+        perror("Error: Failed to allocate the logger");
+        free(logger);
+        free(ring);
+        return NULL;
+    }
+    logger->ring = ring;
+    logger->mask = rounded - 1;
+    atomic_init(&logger->head, 0);
+    atomic_init(&logger->tail, 0);
+    atomic_init(&logger->level, LOG_LEVEL_DEBUG);
+    atomic_init(&logger->categories, LOG_CATEGORY_ALL);
+    atomic_init(&logger->closing, false);
+    logger->output = output;
+    logger->format = format;
+
+    if (format == LOG_FORMAT_BINARY) {
+        LogFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, LOG_FILE_MAGIC, LOG_FILE_MAGIC_SIZE);
+        header.version = LOG_FILE_VERSION;
+        header.byte_order = LOG_FILE_BYTE_ORDER;
+        header.record_size = sizeof(LogRecord);
+        if (fwrite(&header, sizeof(header), 1, output) != 1) logger->failed = true;
+    }
+
+    pthread_mutex_init(&logger->lock, NULL);
+    pthread_cond_init(&logger->wake, NULL);
+    pthread_cond_init(&logger->drained, NULL);
+    if (pthread_create(&logger->thread, NULL, flush_thread, logger) != 0) {
+        perror("Error: Failed to start the logger thread");
+        pthread_mutex_destroy(&logger->lock);
+        pthread_cond_destroy(&logger->wake);
+        pthread_cond_destroy(&logger->drained);
+        free(ring);
+        free(logger);
+        return NULL;
+    }
+    return logger;
+}
+
+void logger_set_level(Logger* logger, LogLevel level) {
+    atomic_store_explicit(&logger->level, level, memory_order_relaxed);
+}
+
+void logger_set_categories(Logger* logger, unsigned categories) {
+    atomic_store_explicit(&logger->categories, categories, memory_order_relaxed);
+}
+
+void logger_event(Logger* logger, LogEvent event, int time, int cpu, int process_id, const char* name, int detail) {
+    LogLevel level = EVENT_CLASSES[event].level;
+    if ((int)level < atomic_load_explicit(&logger->level, memory_order_relaxed) ||
+        !(EVENT_CLASSES[event].category & atomic_load_explicit(&logger->categories, memory_order_relaxed))) {
+        return;
+    }
+
+    size_t head = atomic_load_explicit(&logger->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&logger->tail, memory_order_acquire);
+    while (head - tail > logger->mask) {
+        // Full: hurry the flush thread rather than drop the event
+        pthread_cond_signal(&logger->wake);
+        sched_yield();
+        tail = atomic_load_explicit(&logger->tail, memory_order_acquire);
+    }
+
+    LogRecord* record = &logger->ring[head & logger->mask];
+    record->time = time;
+    record->event = (uint8_t)event;
+    record->level = (uint8_t)level;
+    record->cpu = (int16_t)cpu;
+    record->process_id = process_id;
+    record->detail = detail;
+    strncpy(record->name, name, sizeof(record->name) - 1);
+    record->name[sizeof(record->name) - 1] = '\0';
+    atomic_store_explicit(&logger->head, head + 1, memory_order_release);
+
+    // Wake the flush thread early once half the ring is in use
+    if (head + 1 - tail == (logger->mask + 1) / 2) pthread_cond_signal(&logger->wake);
+}
+
+void logger_flush(Logger* logger) {
+    size_t head = atomic_load_explicit(&logger->head, memory_order_relaxed);
+    pthread_mutex_lock(&logger->lock);
+    pthread_cond_signal(&logger->wake);
+    while (atomic_load_explicit(&logger->tail, memory_order_acquire) != head) {
+        pthread_cond_wait(&logger->drained, &logger->lock);
+    }
+    pthread_mutex_unlock(&logger->lock);
+}
+
+int logger_close(Logger* logger) {
+    if (!logger) return 0;
+    pthread_mutex_lock(&logger->lock);
+    atomic_store(&logger->closing, true);
+    pthread_cond_signal(&logger->wake);
+    pthread_mutex_unlock(&logger->lock);
+    pthread_join(logger->thread, NULL);
+
+    bool ok = !logger->failed;
+    if (!ok) perror("Error: Failed to write the log");
+    pthread_mutex_destroy(&logger->lock);
+    pthread_cond_destroy(&logger->wake);
+    pthread_cond_destroy(&logger->drained);
+    free(logger->ring);
+    free(logger);
+    return ok ? 0 : -1;
+}
+
+
+// Appends text to a line being formatted, stopping at the end of the buffer
+static size_t append_text(char* buffer, size_t used, size_t size, const char* text, size_t length) {
+    if (used + length > size) length = size - used;
+    memcpy(buffer + used, text, length);
+    return used + length;
+}
+
+// Appends a decimal integer (snprintf is the bulk of the cost of a line)
+static size_t append_int(char* buffer, size_t used, size_t size, long long value) {
+    char digits[24];
+    int count = 0;
+    unsigned long long magnitude = (value < 0) ? -(unsigned long long)value : (unsigned long long)value;
+    do {
+        digits[sizeof(digits) - 1 - count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) digits[sizeof(digits) - 1 - count++] = '-';
+    return append_text(buffer, used, size, digits + sizeof(digits) - count, count);
+}
+
+#define APPEND_LITERAL(literal) used = append_text(buffer, used, limit, literal, sizeof(literal) - 1)
+
+int log_record_format(const LogRecord* record, char* buffer, size_t size) {
+    if (size == 0) return 0;
+    size_t limit = size - 1;
+    size_t used = 0;
+    const char* name = record->name;
+    size_t name_length = strnlen(record->name, sizeof(record->name));
+
+    APPEND_LITERAL("Time ");
+    used = append_int(buffer, used, limit, record->time);
+    switch (record->event) {
+        case LOG_EVENT_ARRIVAL:
+            APPEND_LITERAL(": Process ");
+            used = append_text(buffer, used, limit, name, name_length);
+            APPEND_LITERAL(" arrived.");
+            break;
+        case LOG_EVENT_DISPATCH:
+            APPEND_LITERAL(": Process ");
+            used = append_text(buffer, used, limit, name, name_length);
+            if (record->cpu >= 0) {
+                APPEND_LITERAL(" starts running on CPU ");
+                used = append_int(buffer, used, limit, record->cpu);
+                APPEND_LITERAL(".");
+            } else {
+                APPEND_LITERAL(" starts running.");
+            }
+            break;
+        case LOG_EVENT_QUANTUM_EXPIRED:
+            APPEND_LITERAL(": Process ");
+            used = append_text(buffer, used, limit, name, name_length);
+            APPEND_LITERAL(" quantum expired. Demoting.");
+            break;
+        case LOG_EVENT_FINISH:
+            APPEND_LITERAL(": Process ");
+            used = append_text(buffer, used, limit, name, name_length);
+            APPEND_LITERAL(" finished.");
+            break;
+        case LOG_EVENT_STEAL:
+            APPEND_LITERAL(": CPU ");
+            used = append_int(buffer, used, limit, record->cpu);
+            APPEND_LITERAL(" steals process ");
+            used = append_text(buffer, used, limit, name, name_length);
+            APPEND_LITERAL(" from CPU ");
+            used = append_int(buffer, used, limit, record->detail);
+            APPEND_LITERAL(".");
+            break;
+        default:
+            APPEND_LITERAL(": Unknown event ");
+            used = append_int(buffer, used, limit, record->event);
+            APPEND_LITERAL(" for process ");
+            used = append_text(buffer, used, limit, name, name_length);
+            APPEND_LITERAL(".");
+            break;
+    }
+    buffer[used] = '\0';
+    return (int)used;
+}
+
+#undef APPEND_LITERAL
+
+bool log_level_parse(const char* name, LogLevel* level) {
+    for (size_t i = 0; i < sizeof(LEVEL_NAMES) / sizeof(LEVEL_NAMES[0]); i++) {
+        if (strcmp(name, LEVEL_NAMES[i]) == 0) {
+            *level = (LogLevel)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool log_categories_parse(const char* list, unsigned* categories) {
+    unsigned mask = 0;
+    const char* start = list;
+    while (*start) {
+        const char* end = strchr(start, ',');
+        size_t length = end ? (size_t)(end - start) : strlen(start);
+        bool known = false;
+        for (size_t i = 0; i < sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]); i++) {
+            if (strlen(CATEGORY_NAMES[i].name) == length && strncmp(start, CATEGORY_NAMES[i].name, length) == 0) {
+                mask |= CATEGORY_NAMES[i].mask;
+                known = true;
+                break;
+            }
+        }
+        if (!known) return false;
+        start += length;
+        if (*start == ',') start++;
+    }
+    if (mask == 0) return false;
+    *categories = mask;
+    return true;
+}
+
+long long log_decode_file(FILE* input, FILE* output) {
+    LogFileHeader header;
+    if (fread(&header, sizeof(header), 1, input) != 1 ||
+        memcmp(header.magic, LOG_FILE_MAGIC, LOG_FILE_MAGIC_SIZE) != 0) {
+        fprintf(stderr, "Error: Not a binary scheduler log.\n");
+        return -1;
+    }
+    if (header.byte_order != LOG_FILE_BYTE_ORDER || header.version != LOG_FILE_VERSION ||
+        header.record_size != sizeof(LogRecord)) {
+        fprintf(stderr, "Error: Binary log version %u is not supported (expected %d, same byte order).\n", header.version, LOG_FILE_VERSION);
+        return -1;
+    }
+
+    long long count = 0;
+    LogRecord record;
+    char line[LOG_LINE_MAX];
+    while (fread(&record, sizeof(record), 1, input) == 1) {
+        log_record_format(&record, line, sizeof(line));
+        if (fprintf(output, "%s\n", line) < 0) return -1;
+        count++;
+    }
+    return count;
+}
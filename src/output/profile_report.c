@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include "../../headers/output/profile_report.h"
+
+// Events per second of a duration in nanoseconds (0 when nothing was timed)
+static double per_second(long long events, long long ns) {
+    return (ns > 0) ? events * 1e9 / ns : 0;
+}
+
+void print_profile_report(const EngineProfile* profile) {
+    if (!profile) return;
+    static const char* stage_names[PROFILE_STAGE_COUNT] = { "Parse", "Simulate", "Render" };
+    long long simulate_ns = profile->stage_ns[PROFILE_STAGE_SIMULATE];
+
+    printf("\n⏲️  Profile:\n");
+    for (int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+        printf("   - %-8s                : %.3f ms\n", stage_names[s], profile->stage_ns[s] / 1e6);
+    }
+    printf("   - Ticks                   : %lld (%.0f ticks/sec)\n", profile->ticks, per_second(profile->ticks, simulate_ns));
+    printf("   - Decisions               : %lld (%.0f decisions/sec)\n", profile->decisions, per_second(profile->decisions, simulate_ns));
+
+#ifdef SCHED_PROFILE
+    static const char* phase_names[PROFILE_PHASE_COUNT] = {
+        "arrivals", "quantum expiry", "needs_reschedule", "get_next_process", "execution", "  gantt append", "quiet windows"
+    };
+    static const char* call_names[PROFILE_CALL_COUNT] = {
+        "add_process", "get_next_process", "tick", "needs_reschedule", "get_quantum", "demote_process", "ticks_until_event", "advance"
+    };
+
+    printf("   - Stepped Ticks           : %lld (%lld skipped)\n", profile->stepped_ticks, profile->ticks - profile->stepped_ticks);
+
+    printf("\n   | %-18s | %12s | %12s | %9s | %10s |\n", "Phase", "Runs", "Total ms", "ns/run", "% simulate");
+    printf("   |--------------------|--------------|--------------|-----------|------------|\n");
+    for (int p = 0; p < PROFILE_PHASE_COUNT; p++) {
+        long long runs = profile->phase_count[p];
+        long long ns = profile->phase_ns[p];
+        printf("   | %-18s | %12lld | %12.3f | %9.1f | %9.2f%% |\n", phase_names[p], runs, ns / 1e6,
+               runs > 0 ? (double)ns / runs : 0, simulate_ns > 0 ? ns * 100.0 / simulate_ns : 0);
+    }
+
+    printf("\n   | %-18s | %12s | %12s |\n", "Policy call", "Calls", "Calls/tick");
+    printf("   |--------------------|--------------|--------------|\n");
+    for (int c = 0; c < PROFILE_CALL_COUNT; c++) {
+        printf("   | %-18s | %12lld | %12.3f |\n", call_names[c], profile->calls[c],
+               profile->ticks > 0 ? (double)profile->calls[c] / profile->ticks : 0);
+    }
+#else
+    printf("   (phase timings and policy call counts need a build with SCHED_PROFILE: make PROFILE=1)\n");
+#endif
+}
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../headers/output/results_writer.h"
+
+// Output buffer of a results file: records are small, so writes are batched
+#define RESULTS_BUFFER_SIZE (1 << 20)
+
+// The state behind a results sink
+typedef struct {
+    ResultsSink sink;   // Handed out to the engine; its context points back here
+    FILE* file;
+    ResultsFormat format;
+    bool failed;        // Set once any write failed
+} ResultsWriter;
+
+
+static void write_process(void* context, const Process* process) {
+    ResultsWriter* writer = (ResultsWriter*)context;
+    if (writer->format == RESULTS_FORMAT_CSV) {
+        if (fprintf(writer->file, "process,%d,%s,%d,%d,%d,%d,%d,%d,%d,%d\n",
+                    process->original_index, process->name, process->arrival_time, process->burst_time,
+                    process->priority, process->start_time, process->finish_time, process->waiting_time,
+                    process->turnaround_time, process->response_time) < 0) {
+            writer->failed = true;
+        }
+        return;
+    }
+
+    ResultsProcessRecord record;
+    memset(&record, 0, sizeof(record));
+    record.kind = RESULTS_RECORD_PROCESS;
+    record.process_id = process->original_index;
+    record.arrival_time = process->arrival_time;
+    record.burst_time = process->burst_time;
+    record.priority = process->priority;
+    record.start_time = process->start_time;
+    record.finish_time = process->finish_time;
+    record.waiting_time = process->waiting_time;
+    record.turnaround_time = process->turnaround_time;
+    record.response_time = process->response_time;
+    strncpy(record.name, process->name, sizeof(record.name) - 1);
+    if (fwrite(&record, sizeof(record), 1, writer->file) != 1) writer->failed = true;
+}
+
+
+static void write_segment(void* context, int cpu, const GanttSegment* segment) {
+    ResultsWriter* writer = (ResultsWriter*)context;
+    if (writer->format == RESULTS_FORMAT_CSV) {
+        if (fprintf(writer->file, "segment,%d,%d,%d,%d\n", cpu, segment->start_time, segment->end_time, segment->process_id) < 0) {
+            writer->failed = true;
+        }
+        return;
+    }
+
+    ResultsSegmentRecord record = {
+        .kind = RESULTS_RECORD_SEGMENT,
+        .cpu = cpu,
+        .start_time = segment->start_time,
+        .end_time = segment->end_time,
+        .process_id = segment->process_id
+    };
+    if (fwrite(&record, sizeof(record), 1, writer->file) != 1) writer->failed = true;
+}
+
+
+ResultsSink* results_writer_open(const char* filepath, ResultsFormat format) {
+    ResultsWriter* writer = (ResultsWriter*)calloc(1, sizeof(ResultsWriter));
+    if (!writer) {
+        perror("Error: Failed to allocate the results writer");
+        return NULL;
+    }
+
+    writer->file = fopen(filepath, format == RESULTS_FORMAT_CSV ? "w" : "wb");
+    if (!writer->file) {
+        fprintf(stderr, "Error: Could not create results file '%s'.\n", filepath);
+        free(writer);
+        return NULL;
+    }
+    setvbuf(writer->file, NULL, _IOFBF, RESULTS_BUFFER_SIZE);
+    writer->format = format;
+
+    bool ok;
+    if (format == RESULTS_FORMAT_CSV) {
+        ok = fprintf(writer->file, "# process,id,name,arrival_time,burst_time,priority,start_time,finish_time,waiting_time,turnaround_time,response_time\n"
+                                   "# segment,cpu,start_time,end_time,process_id\n") >= 0;
+    } else {
+        ResultsBinaryHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, RESULTS_BINARY_MAGIC, RESULTS_BINARY_MAGIC_SIZE);
+        header.version = RESULTS_BINARY_VERSION;
+        header.byte_order = RESULTS_BINARY_BYTE_ORDER;
+        ok = fwrite(&header, sizeof(header), 1, writer->file) == 1;
+    }
+    writer->failed = !ok;
+
+    writer->sink.on_process = write_process;
+    writer->sink.on_segment = write_segment;
+    writer->sink.context = writer;
+    return &writer->sink;
+}
+
+
+int results_writer_close(ResultsSink* sink) {
+    if (!sink) return 0;
+    ResultsWriter* writer = (ResultsWriter*)sink->context;
+    bool ok = !writer->failed;
+    if (fclose(writer->file) != 0) ok = false;
+    if (!ok) perror("Error: Failed to write the results file");
+    free(writer);
+    return ok ? 0 : -1;
+}
+
+
+int write_telemetry_csv(const char* filepath, const TelemetrySeries* series) {
+    FILE* file = fopen(filepath, "w");
+    if (!file) {
+        perror("Error: Could not create the telemetry file");
+        return -1;
+    }
+    setvbuf(file, NULL, _IOFBF, RESULTS_BUFFER_SIZE);
+
+    bool ok = fprintf(file, "time,ready_length,arrived,in_system,busy_cpus,cpu_busy\n") >= 0;
+    for (int i = 0; i < series->sample_count && ok; i++) {
+        ok = fprintf(file, "%d,%d,%d,%d,%d,", series->time[i], series->ready_length[i], series->arrived[i],
+                     series->in_system[i], telemetry_busy_cpus(series, i)) >= 0;
+        const unsigned char* busy = series->cpu_busy + (size_t)i * series->cpu_count;
+        for (int c = 0; c < series->cpu_count && ok; c++) {
+            ok = fputc(busy[c] ? '1' : '0', file) != EOF;
+        }
+        if (ok) ok = fputc('\n', file) != EOF;
+    }
+    if (fclose(file) != 0) ok = false;
+    if (!ok) perror("Error: Failed to write the telemetry file");
+    return ok ? 0 : -1;
+}
@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <string.h>
+#include "../../headers/output/sweep_table.h"
+
+void print_sweep_table(const SweepRow* rows, int row_count, double wall_ms) {
+    if (!rows || row_count == 0) {
+        printf("No sweep results available.\n");
+        return;
+    }
+
+    // Sizing the config column on the longest path
+    int config_width = 6;
+    for (int i = 0; i < row_count; i++) {
+        int len = (int)strlen(rows[i].config_filepath);
+        if (len > config_width) config_width = len;
+    }
+
+    printf("| %-*s | %-20s | Quantum | Avg Wait | P99 Wait | Avg Turnaround | CPU Util | Makespan | Migrations |   Run ms |\n",
+           config_width, "Config", "Policy");
+    printf("|-");
+    for (int i = 0; i < config_width; i++) printf("-");
+    printf("-|----------------------|---------|----------|----------|----------------|----------|----------|------------|----------|\n");
+
+    double total_run_ms = 0;
+    for (int i = 0; i < row_count; i++) {
+        const SweepRow* row = &rows[i];
+        printf("| %-*s | %-20s | ", config_width, row->config_filepath, row->policy_name);
+        if (row->quantum > 0) printf("%7d | ", row->quantum);
+        else printf("%7s | ", "-");
+
+        if (!row->ok) {
+            printf("%8s | %8s | %14s | %8s | %8s | %10s | %8s |\n", "FAILED", "-", "-", "-", "-", "-", "-");
+            continue;
+        }
+        printf("%8.2f | %8d | %14.2f | %7.2f%% | %8d | %10d | %8.2f |\n",
+               row->average_waiting_time,
+               row->p99_waiting_time,
+               row->average_turnaround_time,
+               row->cpu_utilization,
+               row->makespan,
+               row->migration_count,
+               row->run_ms);
+        total_run_ms += row->run_ms;
+    }
+
+    printf("\n%d runs: %.2f ms of simulation in %.2f ms of wall time", row_count, total_run_ms, wall_ms);
+    if (wall_ms > 0) printf(" (%.2fx)", total_run_ms / wall_ms);
+    printf("\n");
+}
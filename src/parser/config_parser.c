@@ -3,14 +3,30 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdarg.h>
+#include <limits.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
 
 #include "../../headers/parser/config_parser.h"
+#include "../../headers/parser/workload_binary.h"
 #include "../../headers/data_structures/process.h"
 
 
 // Defining an initial capacity for the processes array
 #define INITIAL_CAPACITY 16
 
+// Size of the line buffer of the streaming path: longer lines are read in
+// chunks of LINE_BUFFER_SIZE - 1 bytes, each one counting as its own line
+#define LINE_BUFFER_SIZE 256
+
+// Smallest chunk worth a thread when the thread count is picked automatically
+#define PARALLEL_MIN_CHUNK_BYTES (4 * 1024 * 1024)
+
 
 // Defining the different states the parser can be at
 typedef enum {
@@ -20,7 +36,33 @@ typedef enum {
 } ParserState;
 
 
-// A function to trim the whitespaces from a line 
+// Everything the line parser carries from one line to the next
+typedef struct {
+    Process* processes;
+    int capacity;
+    int* process_count;
+    Process* current_process;
+    ParserState state;
+    int line_number;
+    bool quiet; // Speculative chunk parse: errors are not printed (the chunk is parsed again)
+} ParserContext;
+
+
+// One slice of the file parsed on its own thread, assuming it starts outside any block
+typedef struct {
+    const char* begin;
+    const char* end;
+    ParserContext ctx; // Local processes array, line count and final state
+    int process_count;
+    size_t brace_count;
+    bool ok; // false if the speculative parse hit an error
+    bool kept; // true if the merge keeps the chunk's own result
+    Process* destination; // Where the merge copies a kept result
+    int first_index; // original_index of the chunk's first process in the whole file
+} ParseChunk;
+
+
+// A function to trim the whitespaces from a line
 // Params:
 // @str: a string (will represent a line from the config file)
 // Return:
@@ -40,204 +82,678 @@ char* trim_whitespaces_from_string(char* str) {
 }
 
 
-Process* parse_config_file(const char* filepath, int* process_count) {
-    FILE* file = fopen(filepath, "r");
-    if (!file) {
-        fprintf(stderr, "Error: Could not open config file '%s'.\n", filepath);
-        return NULL;
-    }
+// Whitespace as the "C" locale defines it (what isspace() and sscanf() use here)
+static inline bool is_blank(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
 
-    char line[256];
-    int line_number = 0;
-    int capacity = INITIAL_CAPACITY;
 
-    Process* processes = malloc(sizeof(Process) * capacity);
-    if (!processes) {
-        fprintf(stderr, "Error: Memory allocation failed for processes array.\n");
-        return NULL;
+// Trims a [begin, end) range in place, without writing to it
+static inline void trim_range(const char** begin, const char** end) {
+    while (*begin < *end && is_blank(**begin)) (*begin)++;
+    while (*end > *begin && is_blank(*(*end - 1))) (*end)--;
+}
+
+
+// Tells if the [begin, end) range holds exactly the given word
+static inline bool range_equals(const char* begin, const char* end, const char* word, size_t length) {
+    return (size_t)(end - begin) == length && memcmp(begin, word, length) == 0;
+}
+
+
+// Converts a trimmed value the way atoi() does: optional sign, then digits up to the first
+// non-digit. Out-of-range values saturate like strtol() before being narrowed to an int.
+static int range_to_int(const char* begin, const char* end) {
+    bool negative = false;
+    if (begin < end && (*begin == '+' || *begin == '-')) {
+        negative = (*begin == '-');
+        begin++;
     }
 
-    *process_count = 0;
-    Process* current_process = NULL;
-    ParserState state = IDLE;
-
-    while(fgets(line, sizeof(line), file)) {
-        line_number++;
-        // UNUSED : char* original_line_ptr = line;
-        char* trimmed_line = trim_whitespaces_from_string(line);        
-        
-        // Case : Single-line comment (Starting with #) 
-        char* comment_position = strchr(trimmed_line, '#');
-        if (comment_position != NULL) {
-            *comment_position = '\0';
-            trimmed_line = trim_whitespaces_from_string(trimmed_line);
-        }
-        
-        // Case : Empty line
-        if (strlen(trimmed_line) == 0) {
+    unsigned long magnitude = 0;
+    unsigned long limit = negative ? (unsigned long)LONG_MAX + 1 : (unsigned long)LONG_MAX;
+    bool overflow = false;
+    for (; begin < end && *begin >= '0' && *begin <= '9'; begin++) {
+        unsigned long digit = (unsigned long)(*begin - '0');
+        if (overflow || magnitude > (limit - digit) / 10) {
+            overflow = true;
             continue;
         }
+        magnitude = magnitude * 10 + digit;
+    }
+    if (overflow) magnitude = limit;
 
-        // Case : Multi-line comment (Starting and ending with """)
-        if (strncmp(trimmed_line, "\"\"\"", 3) == 0) {
-            if (state == IDLE) state = IN_COMMENT_BLOCK;
-            else if (state == IN_COMMENT_BLOCK) state = IDLE;
-            continue;
+    long value = negative ? (long)(0 - magnitude) : (long)magnitude;
+    return (int)value;
+}
+
+
+// Prints a parse error, unless the context is a speculative chunk parse
+static void parse_error(const ParserContext* ctx, const char* format, ...) {
+    if (ctx->quiet) return;
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+}
+
+
+// Claims the next slot of the processes array and initializes it
+// Return:
+// The new process OTHERWISE NULL if the array could not grow
+static Process* start_process(ParserContext* ctx, const char* name, size_t name_length) {
+    // Checking if the array is running out of places for new processes
+    if (*ctx->process_count >= ctx->capacity) {
+        int capacity = ctx->capacity * 2;
+        Process* new_processes = realloc(ctx->processes, sizeof(Process) * capacity);
+        if (!new_processes) {
+            parse_error(ctx, "Error line %d: Memory reallocation failed.\n", ctx->line_number);
+            return NULL;
         }
 
-        switch(state) {
-            // Find : "process <name> {"
-            case IDLE: {
-                // Matching the first line pattern to extract the process name
-                char process_name[32];
-                if (sscanf(trimmed_line, "process %31s {", process_name) == 1) {
-                    // Used to use it to show the process name but an another function now handles this output
-                    // printf("Found new process: %s\n", process_name);
-                }
+        // Making the newly-reallocated array the main processes array
+        ctx->processes = new_processes;
+        ctx->capacity = capacity;
+    }
 
-                // Checking if the array is running out of places for new processes
-                if (*process_count >= capacity) {
-                    capacity *= 2;
-                    Process* new_processes = realloc(processes, sizeof(Process) * capacity);
-                    if (!new_processes) {
-                        fprintf(stderr, "Error line %d: Memory reallocation failed.\n", line_number);
-                        free(processes);
-                        fclose(file);
-                        return NULL;
-                    }
-
-                    // Making the newly-reallocated array the main processes array
-                    processes = new_processes;
-                }
-                
-                // Initializing the current process name
-                current_process = &processes[*process_count];
-                strncpy(current_process->name, process_name, sizeof(current_process->name) - 1);
-                // Ensure null-termination at the end of the buffer for safety
-                current_process->name[sizeof(current_process->name) - 1] = '\0';
-
-                // Initializing the other fields of the current process
-                current_process->arrival_time = -1; // REQUIRED field
-                current_process->burst_time = -1; // REQUIRED field
-                current_process->priority = 0; // OPTIONAL field
-                current_process->original_index = *process_count; // Set original index
-
-                // Initializing the runtime metrics to 0
-                current_process->start_time = 0;
-                current_process->finish_time = 0;
-                current_process->waiting_time = 0;
-                current_process->turnaround_time = 0;
-                current_process->response_time = 0;
-                current_process->remaining_burst_time = 0;
-                current_process->executed_time = 0;
-                current_process->last_executed_time = 0;
-                current_process->is_preempted = false;
-                current_process->current_quantum_runtime = 0; // Initialize the new field
-                
-                // MLFQ Initialization
-                current_process->last_active_time = 0;
-                current_process->current_queue_level = 0;
-                current_process->time_spent_at_current_level = 0;
-
-                // Changing the state of the process
-                state = IN_PROCESS;
+    // Every runtime metric (and the MLFQ tracking fields) starts at 0
+    Process* process = &ctx->processes[*ctx->process_count];
+    memset(process, 0, sizeof(Process));
+
+    // Initializing the current process name, truncated to fit the buffer
+    if (name_length > sizeof(process->name) - 1) name_length = sizeof(process->name) - 1;
+    memcpy(process->name, name, name_length);
+    process->name[name_length] = '\0';
+
+    // Initializing the other fields of the current process
+    process->arrival_time = -1; // REQUIRED field
+    process->burst_time = -1; // REQUIRED field
+    process->priority = 0; // OPTIONAL field
+    process->original_index = *ctx->process_count; // Set original index
+    return process;
+}
+
+
+// Parses one line of the config file
+// Params:
+// @ctx: the parser state, updated in place
+// @line: first character of the line (the range is never written to)
+// @line_end: one past its last character
+// Return:
+// true OTHERWISE false after printing an error
+static bool parse_line(ParserContext* ctx, const char* line, const char* line_end) {
+    trim_range(&line, &line_end);
+
+    // Case : Single-line comment (Starting with #)
+    const char* comment_position = memchr(line, '#', line_end - line);
+    if (comment_position != NULL) {
+        line_end = comment_position;
+        trim_range(&line, &line_end);
+    }
+
+    // Case : Empty line
+    if (line == line_end) {
+        return true;
+    }
+
+    // Case : Multi-line comment (Starting and ending with """)
+    if (line_end - line >= 3 && memcmp(line, "\"\"\"", 3) == 0) {
+        if (ctx->state == IDLE) ctx->state = IN_COMMENT_BLOCK;
+        else if (ctx->state == IN_COMMENT_BLOCK) ctx->state = IDLE;
+        return true;
+    }
+
+    switch (ctx->state) {
+        // Find : "process <name> {"
+        case IDLE: {
+            // Matching the first line pattern to extract the process name (at most 31 characters,
+            // like sscanf's "process %31s {"); any other line opens an unnamed process
+            const char* name = line_end;
+            size_t name_length = 0;
+            if (line_end - line >= 7 && memcmp(line, "process", 7) == 0) {
+                name = line + 7;
+                while (name < line_end && is_blank(*name)) name++;
+                while (name + name_length < line_end && name_length < 31 && !is_blank(name[name_length])) name_length++;
             }
-                break;
-            
-            // Parse : "key = value" OR Find : }
-            case IN_PROCESS: {
-                // Case : End of process : "}"
-                if (strcmp(trimmed_line, "}") == 0) {
-                    // Stating an error if any of the fields wasn't given a valid value
-                    if ((current_process->arrival_time < 0) || (current_process->burst_time <= 0)) {
-                        fprintf(stderr, "Error parsing process %s: missing or invalid 'arrival_time' or 'burst_time'.\n", current_process->name);
-                        free(processes);
-                        fclose(file);
-                        return NULL;
-                    }
-
-                    (*process_count)++;
-                    current_process = NULL;
-                    state = IDLE;
-                    break;
-                }
 
-                // Case : Parsing a key-value pair "key = value"
-                char* key = trimmed_line;
-                char* value_str = strchr(trimmed_line, '=');
+            ctx->current_process = start_process(ctx, name, name_length);
+            if (!ctx->current_process) return false;
 
-                // Stating an error if there is no equal sign (=)
-                if (value_str == NULL) {
-                    fprintf(stderr, "Error line %d: Invalid syntax in process block: '%s'. Expected 'key = value'.\n", line_number, trimmed_line);
-                    free(processes);
-                    fclose(file);
-                    return NULL;
-                }
+            // Changing the state of the process
+            ctx->state = IN_PROCESS;
+            return true;
+        }
 
-                *value_str = '\0'; // Splitting the line at the equal sign
-                value_str++; // Moving after the sign
-
-                // Trimming the pair and converting the value to an integer 
-                key = trim_whitespaces_from_string(key);
-                value_str = trim_whitespaces_from_string(value_str);
-                int value = atoi(value_str);
-
-                // Checking the key refers to which field of the process
-                if (strcmp(key, "arrival_time") == 0) {
-                    current_process->arrival_time = value;
-                    if (value < 0) {
-                        fprintf(stderr, "Error line %d: 'arrival_time' value cannot be negative for process '%s'.\n", line_number, current_process->name);
-                        free(processes);
-                        fclose(file);
-                        return NULL;
-                    }
-                } else if (strcmp(key, "burst_time") == 0) {
-                    if (value <= 0) {
-                        fprintf(stderr, "Error line %d: 'burst_time' value must be positive for process '%s'.\n", line_number, current_process->name);
-                        free(processes);
-                        fclose(file);
-                        return NULL;
-                    }
-                    current_process->burst_time = value;
-                    current_process->remaining_burst_time = value;
-                } else if (strcmp(key, "priority") == 0) {
-                    if (value < 0) {
-                        fprintf(stderr, "Error line %d: 'priority' value cannot be negative for process '%s'.\n", line_number, current_process->name);
-                        free(processes);
-                        fclose(file);
-                        return NULL;
-                    }
-                    current_process->priority = value;
-                } else {
-                    fprintf(stderr, "Error line %d: Unknown key '%s' for process '%s'.\n", line_number, key, current_process->name);
-                    free(processes);
-                    fclose(file);
-                    return NULL;                    
+        // Parse : "key = value" OR Find : }
+        case IN_PROCESS: {
+            Process* current_process = ctx->current_process;
+
+            // Case : End of process : "}"
+            if (range_equals(line, line_end, "}", 1)) {
+                // Stating an error if any of the fields wasn't given a valid value
+                if ((current_process->arrival_time < 0) || (current_process->burst_time <= 0)) {
+                    parse_error(ctx, "Error parsing process %s: missing or invalid 'arrival_time' or 'burst_time'.\n", current_process->name);
+                    return false;
                 }
 
+                (*ctx->process_count)++;
+                ctx->current_process = NULL;
+                ctx->state = IDLE;
+                return true;
+            }
+
+            // Case : Parsing a key-value pair "key = value"
+            const char* equal_sign = memchr(line, '=', line_end - line);
+
+            // Stating an error if there is no equal sign (=)
+            if (equal_sign == NULL) {
+                parse_error(ctx, "Error line %d: Invalid syntax in process block: '%.*s'. Expected 'key = value'.\n", ctx->line_number, (int)(line_end - line), line);
+                return false;
             }
-            break;
 
-            // Ignore the current line
-            case IN_COMMENT_BLOCK:
-                continue;
+            // Splitting the line at the equal sign, then trimming the pair
+            const char* key = line;
+            const char* key_end = equal_sign;
+            const char* value = equal_sign + 1;
+            const char* value_end = line_end;
+            trim_range(&key, &key_end);
+            trim_range(&value, &value_end);
+            int parsed_value = range_to_int(value, value_end);
+
+            // Checking the key refers to which field of the process
+            if (range_equals(key, key_end, "arrival_time", 12)) {
+                current_process->arrival_time = parsed_value;
+                if (parsed_value < 0) {
+                    parse_error(ctx, "Error line %d: 'arrival_time' value cannot be negative for process '%s'.\n", ctx->line_number, current_process->name);
+                    return false;
+                }
+            } else if (range_equals(key, key_end, "burst_time", 10)) {
+                if (parsed_value <= 0) {
+                    parse_error(ctx, "Error line %d: 'burst_time' value must be positive for process '%s'.\n", ctx->line_number, current_process->name);
+                    return false;
+                }
+                current_process->burst_time = parsed_value;
+                current_process->remaining_burst_time = parsed_value;
+            } else if (range_equals(key, key_end, "priority", 8)) {
+                if (parsed_value < 0) {
+                    parse_error(ctx, "Error line %d: 'priority' value cannot be negative for process '%s'.\n", ctx->line_number, current_process->name);
+                    return false;
+                }
+                current_process->priority = parsed_value;
+            } else {
+                parse_error(ctx, "Error line %d: Unknown key '%.*s' for process '%s'.\n", ctx->line_number, (int)(key_end - key), key, current_process->name);
+                return false;
+            }
+            return true;
         }
+
+        // Ignore the current line
+        case IN_COMMENT_BLOCK:
+            return true;
     }
+    return true;
+}
 
-    // Final validation
-    if (state == IN_PROCESS) {
-        fprintf(stderr, "Error: Unexpected end of file while parsing process '%s'.\n", current_process->name);
-        free(processes);
-        fclose(file);
-        return NULL;
+
+// Checks that the file did not stop in the middle of a block
+static bool finish_parse(const ParserContext* ctx) {
+    if (ctx->state == IN_PROCESS) {
+        fprintf(stderr, "Error: Unexpected end of file while parsing process '%s'.\n", ctx->current_process->name);
+        return false;
     }
 
-    if (state == IN_COMMENT_BLOCK) {
+    if (ctx->state == IN_COMMENT_BLOCK) {
         fprintf(stderr, "Error: Unexpected end of file while in multi-line comment block. Missing '\"\"\"' \n");
-        free(processes);
-        fclose(file);
+        return false;
+    }
+    return true;
+}
+
+
+// Allocates the processes array and resets the parser state
+static bool init_context(ParserContext* ctx, int capacity, int* process_count) {
+    ctx->capacity = capacity < INITIAL_CAPACITY ? INITIAL_CAPACITY : capacity;
+    ctx->processes = malloc(sizeof(Process) * ctx->capacity);
+    if (!ctx->processes) {
+        fprintf(stderr, "Error: Memory allocation failed for processes array.\n");
+        return false;
+    }
+
+    *process_count = 0;
+    ctx->process_count = process_count;
+    ctx->current_process = NULL;
+    ctx->state = IDLE;
+    ctx->line_number = 0;
+    ctx->quiet = false;
+    return true;
+}
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+Process* parse_config_stream(FILE* file, int* process_count) {
+    ParserContext ctx;
+    if (!init_context(&ctx, INITIAL_CAPACITY, process_count)) return NULL;
+
+    char line[LINE_BUFFER_SIZE];
+    while (fgets(line, sizeof(line), file)) {
+        ctx.line_number++;
+        if (!parse_line(&ctx, line, line + strlen(line))) {
+            free(ctx.processes);
+            return NULL;
+        }
+    }
+
+    if (!finish_parse(&ctx)) {
+        free(ctx.processes);
+        return NULL;
+    }
+    return ctx.processes;
+}
+
+
+// Upper bound on the processes in [begin, end): every process ends with a "}" line
+static size_t count_braces(const char* begin, const char* end) {
+    size_t brace_count = 0;
+    for (const char* brace = begin; (brace = memchr(brace, '}', end - brace)) != NULL; brace++) {
+        brace_count++;
+    }
+    return brace_count;
+}
+
+
+// Parses every line of [cursor, end) into the context
+// Lines are cut exactly where the streaming path's fgets() would cut them, so that
+// both paths report the same line numbers
+static bool parse_range(ParserContext* ctx, const char* cursor, const char* end) {
+    while (cursor < end) {
+        ctx->line_number++;
+        const char* limit = (size_t)(end - cursor) > LINE_BUFFER_SIZE - 1 ? cursor + LINE_BUFFER_SIZE - 1 : end;
+        const char* newline = memchr(cursor, '\n', limit - cursor);
+        const char* next = newline ? newline + 1 : limit;
+
+        // A NUL byte ends the line's text, as it would in the fgets() buffer
+        const char* text_end = memchr(cursor, '\0', next - cursor);
+        if (!parse_line(ctx, cursor, text_end ? text_end : next)) return false;
+        cursor = next;
+    }
+    return true;
+}
+
+
+// Start of the line after the first "}" line found at or after `from` OTHERWISE end
+// A split there is only a guess (the "}" may sit in a comment block): the merge checks it
+static const char* next_block_boundary(const char* begin, const char* from, const char* end) {
+    const char* line = from;
+    if (line > begin && line[-1] != '\n') {
+        const char* newline = memchr(line, '\n', end - line);
+        if (!newline) return end;
+        line = newline + 1;
+    }
+
+    while (line < end) {
+        const char* newline = memchr(line, '\n', end - line);
+        const char* text = line;
+        const char* text_end = newline ? newline : end;
+        const char* comment_position = memchr(text, '#', text_end - text);
+        if (comment_position) text_end = comment_position;
+        trim_range(&text, &text_end);
+        if (!newline) return end;
+        if (range_equals(text, text_end, "}", 1)) return newline + 1;
+        line = newline + 1;
+    }
+    return end;
+}
+
+
+// Thread body: parses one chunk into its own array, silently
+static void* parse_chunk(void* arg) {
+    ParseChunk* chunk = (ParseChunk*)arg;
+    chunk->brace_count = count_braces(chunk->begin, chunk->end);
+    size_t capacity = chunk->brace_count + 1;
+    chunk->ok = capacity < (size_t)INT_MAX && init_context(&chunk->ctx, (int)capacity, &chunk->process_count);
+    if (!chunk->ok) {
+        chunk->ctx.processes = NULL;
+        return NULL;
+    }
+
+    chunk->ctx.quiet = true;
+    chunk->ok = parse_range(&chunk->ctx, chunk->begin, chunk->end) && chunk->ctx.state == IDLE;
+    return NULL;
+}
+
+
+// Thread body: copies a kept chunk to its place in the merged array
+static void* merge_chunk(void* arg) {
+    ParseChunk* chunk = (ParseChunk*)arg;
+    if (!chunk->kept) return NULL;
+    memcpy(chunk->destination, chunk->ctx.processes, sizeof(Process) * chunk->process_count);
+    for (int i = 0; i < chunk->process_count; i++) chunk->destination[i].original_index += chunk->first_index;
+    return NULL;
+}
+
+
+// Runs body on every chunk, one thread each; chunk 0 (and any chunk whose thread cannot
+// start) runs on the calling thread
+// Return:
+// true OTHERWISE false if the thread handles could not be allocated
+static bool run_on_chunks(ParseChunk* chunks, int chunk_count, void* (*body)(void*)) {
+    pthread_t* threads = malloc(sizeof(pthread_t) * chunk_count);
+    bool* started = calloc(chunk_count, sizeof(bool));
+    if (!threads || !started) {
+        fprintf(stderr, "Error: Memory allocation failed for parser threads.\n");
+        free(threads);
+        free(started);
+        return false;
+    }
+
+    for (int i = 1; i < chunk_count; i++) {
+        started[i] = pthread_create(&threads[i], NULL, body, &chunks[i]) == 0;
+    }
+    body(&chunks[0]);
+    for (int i = 1; i < chunk_count; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+        else body(&chunks[i]);
+    }
+
+    free(threads);
+    free(started);
+    return true;
+}
+
+
+// Number of threads to use for a buffer of the given size when none is requested
+static int default_thread_count(size_t size) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t by_size = size / PARALLEL_MIN_CHUNK_BYTES;
+    if (cpus < 1) cpus = 1;
+    return (size_t)cpus < by_size ? (int)cpus : (by_size > 0 ? (int)by_size : 1);
+}
+
+
+// Gives back the slots the pre-scan over-estimated (braces inside comments)
+static Process* shrink_to_fit(ParserContext* ctx) {
+    int count = *ctx->process_count;
+    if (count < ctx->capacity / 2) {
+        Process* shrunk = realloc(ctx->processes, sizeof(Process) * (count > 0 ? count : 1));
+        if (shrunk) ctx->processes = shrunk;
+    }
+    return ctx->processes;
+}
+
+
+// Single-threaded parse of a whole buffer
+static Process* parse_buffer_sequential(const char* data, size_t size, int* process_count) {
+    // Pre-scan: the number of braces (plus the one process that may still be open)
+    // bounds the number of slots ever claimed
+    size_t brace_count = count_braces(data, data + size);
+    int capacity = brace_count < (size_t)INT_MAX ? (int)brace_count + 1 : INT_MAX;
+
+    ParserContext ctx;
+    if (!init_context(&ctx, capacity, process_count)) return NULL;
+
+    if (!parse_range(&ctx, data, data + size) || !finish_parse(&ctx)) {
+        free(ctx.processes);
         return NULL;
     }
 
+    return shrink_to_fit(&ctx);
+}
+
+
+Process* parse_config_buffer(const char* data, size_t size, int* process_count) {
+    return parse_config_buffer_parallel(data, size, process_count, 0);
+}
+
+
+Process* parse_config_buffer_parallel(const char* data, size_t size, int* process_count, int thread_count) {
+    if (thread_count <= 0) thread_count = default_thread_count(size);
+    if (thread_count <= 1 || size < 2) return parse_buffer_sequential(data, size, process_count);
+
+    // Splitting after "}" lines near every 1/thread_count of the file (chunks may come out empty)
+    ParseChunk* chunks = calloc(thread_count, sizeof(ParseChunk));
+    if (!chunks) return parse_buffer_sequential(data, size, process_count);
+
+    const char* end = data + size;
+    const char* begin = data;
+    for (int i = 0; i < thread_count; i++) {
+        chunks[i].begin = begin;
+        if (i == thread_count - 1) {
+            chunks[i].end = end;
+        } else {
+            const char* target = data + (size / thread_count) * (i + 1);
+            chunks[i].end = target <= begin ? begin : next_block_boundary(data, target, end);
+        }
+        begin = chunks[i].end;
+    }
+
+    bool ok = run_on_chunks(chunks, thread_count, parse_chunk);
+
+    // Validating in file order. A chunk's own result is kept only if the file really is outside
+    // any block where it starts, and the chunk ends outside one too; otherwise the chunk is
+    // parsed again from the real state, which also prints any error with its true line number
+    size_t brace_total = 0;
+    for (int i = 0; i < thread_count; i++) brace_total += chunks[i].brace_count;
+    int capacity = brace_total < (size_t)INT_MAX ? (int)brace_total + 1 : INT_MAX;
+
+    ParserContext ctx = {0};
+    ok = ok && init_context(&ctx, capacity, process_count);
+    for (int i = 0; i < thread_count && ok; i++) {
+        ParseChunk* chunk = &chunks[i];
+        chunk->kept = ctx.state == IDLE && chunk->ok;
+        if (chunk->kept) {
+            chunk->first_index = *process_count;
+            *process_count += chunk->process_count;
+            ctx.line_number += chunk->ctx.line_number;
+        } else {
+            ok = parse_range(&ctx, chunk->begin, chunk->end);
+        }
+    }
+    ok = ok && finish_parse(&ctx);
+
+    // Copying the kept results into place, again one thread per chunk (the array no longer moves)
+    if (ok) {
+        for (int i = 0; i < thread_count; i++) chunks[i].destination = ctx.processes + chunks[i].first_index;
+        ok = run_on_chunks(chunks, thread_count, merge_chunk);
+    }
+
+    for (int i = 0; i < thread_count; i++) free(chunks[i].ctx.processes);
+    free(chunks);
+    if (!ok) {
+        free(ctx.processes);
+        return NULL;
+    }
+    return shrink_to_fit(&ctx);
+}
+
+
+// Reads a file that cannot be mapped (a pipe, for instance) until EOF
+// Return:
+// A dynamically-allocated copy of its contents OTHERWISE NULL
+static char* read_whole_file(int fd, size_t* size) {
+    size_t capacity = 64 * 1024;
+    char* buffer = malloc(capacity);
+    *size = 0;
+    while (buffer) {
+        if (*size == capacity) {
+            char* grown = realloc(buffer, capacity * 2);
+            if (!grown) break;
+            buffer = grown;
+            capacity *= 2;
+        }
+        ssize_t length = read(fd, buffer + *size, capacity - *size);
+        if (length == 0) return buffer;
+        if (length < 0) break;
+        *size += (size_t)length;
+    }
+    free(buffer);
+    return NULL;
+}
+
+
+Process* parse_config_file_with_stats(const char* filepath, int* process_count, ParseStats* stats) {
+    double start = now_seconds();
+    ParseStats local_stats = {0};
+
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: Could not open config file '%s'.\n", filepath);
+        return NULL;
+    }
+
+    // Regular files are mapped and used in place; anything else (pipes, empty files, or a
+    // failed mapping) is read into memory first
+    struct stat info;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        flags |= MAP_POPULATE; // Every page is read anyway: fault them all in with one call
+#endif
+        mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, flags, fd, 0);
+    }
+
+    const char* data = NULL;
+    size_t size = 0;
+    char* buffer = NULL;
+    if (mapping != MAP_FAILED) {
+        madvise(mapping, (size_t)info.st_size, MADV_SEQUENTIAL);
+        data = (const char*)mapping;
+        size = (size_t)info.st_size;
+        local_stats.mapped = true;
+    } else {
+        buffer = read_whole_file(fd, &size);
+        if (!buffer) {
+            fprintf(stderr, "Error: Could not read config file '%s'.\n", filepath);
+            close(fd);
+            return NULL;
+        }
+        data = buffer;
+    }
+
+    // Binary workloads are recognized by their magic number, whatever the file name
+    Process* processes = NULL;
+    if (is_binary_workload(data, size)) {
+        local_stats.binary = true;
+        local_stats.threads = 1;
+        processes = load_binary_workload(data, size, process_count);
+    } else {
+        local_stats.threads = default_thread_count(size);
+        processes = parse_config_buffer_parallel(data, size, process_count, local_stats.threads);
+    }
+
+    if (mapping != MAP_FAILED) munmap(mapping, size);
+    free(buffer);
+    close(fd);
+    local_stats.bytes = size;
+
+    local_stats.seconds = now_seconds() - start;
+    if (stats) *stats = local_stats;
     return processes;
-}
\ No newline at end of file
+}
+
+
+// An open config file handing out one process at a time
+struct ConfigReader {
+    FILE* file; // Text configs: read line by line
+    ParserContext ctx; // Text configs: holds at most the one process being completed
+    int completed; // Text configs: 1 once ctx holds a finished process
+    const char* mapping; // Binary workloads: the mapped file
+    size_t mapping_size;
+    int record_count; // Binary workloads: number of records
+    int next_index; // original_index of the next process handed out
+};
+
+
+ConfigReader* config_reader_open(const char* filepath) {
+    ConfigReader* reader = calloc(1, sizeof(ConfigReader));
+    if (!reader) {
+        fprintf(stderr, "Error: Memory allocation failed for config reader.\n");
+        return NULL;
+    }
+
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: Could not open config file '%s'.\n", filepath);
+        free(reader);
+        return NULL;
+    }
+
+    // Binary workloads are only read through a mapping (their names come last in the file)
+    struct stat info;
+    char magic[BINARY_WORKLOAD_MAGIC_SIZE];
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) &&
+        pread(fd, magic, sizeof(magic), 0) == (ssize_t)sizeof(magic) && is_binary_workload(magic, sizeof(magic))) {
+        void* mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            fprintf(stderr, "Error: Could not map binary workload '%s'.\n", filepath);
+            free(reader);
+            return NULL;
+        }
+        madvise(mapping, (size_t)info.st_size, MADV_SEQUENTIAL);
+        reader->mapping = (const char*)mapping;
+        reader->mapping_size = (size_t)info.st_size;
+        reader->record_count = binary_workload_count(reader->mapping, reader->mapping_size);
+        if (reader->record_count < 0) {
+            config_reader_close(reader);
+            return NULL;
+        }
+        return reader;
+    }
+
+    reader->file = fdopen(fd, "r");
+    if (!reader->file || !init_context(&reader->ctx, INITIAL_CAPACITY, &reader->completed)) {
+        fprintf(stderr, "Error: Could not open config file '%s'.\n", filepath);
+        if (reader->file) fclose(reader->file);
+        else close(fd);
+        free(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+
+int config_reader_next(ConfigReader* reader, Process* process) {
+    if (reader->mapping) {
+        if (reader->next_index >= reader->record_count) return 0;
+        if (!binary_workload_get(reader->mapping, reader->next_index, process)) return -1;
+        reader->next_index++;
+        return 1;
+    }
+
+    // Feeding lines to the parser until it closes a process block; the context's array is
+    // emptied every time, so only one process is ever held
+    char line[LINE_BUFFER_SIZE];
+    while (reader->completed == 0) {
+        if (!fgets(line, sizeof(line), reader->file)) {
+            return finish_parse(&reader->ctx) ? 0 : -1;
+        }
+        reader->ctx.line_number++;
+        if (!parse_line(&reader->ctx, line, line + strlen(line))) return -1;
+    }
+
+    *process = reader->ctx.processes[0];
+    process->original_index = reader->next_index++;
+    reader->completed = 0;
+    return 1;
+}
+
+
+void config_reader_close(ConfigReader* reader) {
+    if (!reader) return;
+    if (reader->file) fclose(reader->file);
+    if (reader->mapping) munmap((void*)reader->mapping, reader->mapping_size);
+    free(reader->ctx.processes);
+    free(reader);
+}
+
+
+Process* parse_config_file(const char* filepath, int* process_count) {
+    return parse_config_file_with_stats(filepath, process_count, NULL);
+}
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../headers/parser/workload_binary.h"
+
+
+// Records start at the first multiple of this after the header
+#define RECORD_ALIGNMENT 8
+
+
+bool is_binary_workload(const char* data, size_t size) {
+    return size >= BINARY_WORKLOAD_MAGIC_SIZE && memcmp(data, BINARY_WORKLOAD_MAGIC, BINARY_WORKLOAD_MAGIC_SIZE) == 0;
+}
+
+
+int binary_workload_count(const char* data, size_t size) {
+    BinaryWorkloadHeader header;
+    if (!is_binary_workload(data, size) || size < sizeof(header)) {
+        fprintf(stderr, "Error: Binary workload is truncated (no complete header).\n");
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    if (header.byte_order != BINARY_WORKLOAD_BYTE_ORDER) {
+        fprintf(stderr, "Error: Binary workload was written on a machine with another byte order.\n");
+        return -1;
+    }
+    if (header.version != BINARY_WORKLOAD_VERSION) {
+        fprintf(stderr, "Error: Binary workload version %u is not supported (expected %d).\n", header.version, BINARY_WORKLOAD_VERSION);
+        return -1;
+    }
+    if (header.process_count > (uint64_t)INT32_MAX ||
+        header.records_offset % RECORD_ALIGNMENT != 0 || header.records_offset > size ||
+        header.process_count > (size - header.records_offset) / sizeof(BinaryProcessRecord) ||
+        header.names_offset > size || header.names_size > size - header.names_offset ||
+        (header.names_size > 0 && data[header.names_offset + header.names_size - 1] != '\0')) {
+        fprintf(stderr, "Error: Binary workload is corrupted (sections out of bounds).\n");
+        return -1;
+    }
+    return (int)header.process_count;
+}
+
+
+bool binary_workload_get(const char* data, int index, Process* process) {
+    BinaryWorkloadHeader header;
+    memcpy(&header, data, sizeof(header));
+    const BinaryProcessRecord* record = (const BinaryProcessRecord*)(data + header.records_offset) + index;
+    const char* names = data + header.names_offset;
+
+    if (record->name_offset >= header.names_size) {
+        fprintf(stderr, "Error: Binary workload is corrupted (process %d has no name).\n", index);
+        return false;
+    }
+    if (record->arrival_time < 0 || record->burst_time <= 0 || record->priority < 0) {
+        fprintf(stderr, "Error: Binary workload process '%.31s' has an invalid arrival_time, burst_time or priority.\n", names + record->name_offset);
+        return false;
+    }
+
+    memset(process, 0, sizeof(Process));
+    strncpy(process->name, names + record->name_offset, sizeof(process->name) - 1);
+    process->arrival_time = record->arrival_time;
+    process->burst_time = record->burst_time;
+    process->remaining_burst_time = record->burst_time;
+    process->priority = record->priority;
+    process->original_index = index;
+    return true;
+}
+
+
+Process* load_binary_workload(const char* data, size_t size, int* process_count) {
+    int count = binary_workload_count(data, size);
+    if (count < 0) return NULL;
+
+    Process* processes = malloc(sizeof(Process) * (count > 0 ? count : 1));
+    if (!processes) {
+        fprintf(stderr, "Error: Memory allocation failed for processes array.\n");
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!binary_workload_get(data, i, &processes[i])) {
+            free(processes);
+            return NULL;
+        }
+    }
+
+    *process_count = count;
+    return processes;
+}
+
+
+// FNV-1a, to intern names while writing
+static uint32_t hash_name(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (; *name; name++) hash = (hash ^ (unsigned char)*name) * 16777619u;
+    return hash;
+}
+
+
+int write_binary_workload(const char* filepath, const Process* processes, int count) {
+    // Interning: slots of an open-addressing table hold 1 + the index of the first process
+    // with that name, 0 if empty
+    size_t slot_count = 16;
+    while (slot_count < (size_t)count * 2) slot_count *= 2;
+    int* slots = calloc(slot_count, sizeof(int));
+    BinaryProcessRecord* records = malloc(sizeof(BinaryProcessRecord) * (count > 0 ? count : 1));
+    char* names = malloc(sizeof(processes->name) * (count > 0 ? count : 1));
+    if (!slots || !records || !names) {
+        perror("Error: Failed to allocate the binary workload");
+        free(slots);
+        free(records);
+        free(names);
+        return -1;
+    }
+
+    size_t names_size = 0;
+    for (int i = 0; i < count; i++) {
+        const char* name = processes[i].name;
+        size_t slot = hash_name(name) & (slot_count - 1);
+        while (slots[slot] != 0 && strcmp(processes[slots[slot] - 1].name, name) != 0) {
+            slot = (slot + 1) & (slot_count - 1);
+        }
+
+        if (slots[slot] == 0) {
+            slots[slot] = i + 1;
+            records[i].name_offset = (uint32_t)names_size;
+            size_t length = strnlen(name, sizeof(processes->name) - 1);
+            memcpy(names + names_size, name, length);
+            names[names_size + length] = '\0';
+            names_size += length + 1;
+        } else {
+            records[i].name_offset = records[slots[slot] - 1].name_offset;
+        }
+        records[i].arrival_time = processes[i].arrival_time;
+        records[i].burst_time = processes[i].burst_time;
+        records[i].priority = processes[i].priority;
+    }
+
+    BinaryWorkloadHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BINARY_WORKLOAD_MAGIC, BINARY_WORKLOAD_MAGIC_SIZE);
+    header.version = BINARY_WORKLOAD_VERSION;
+    header.byte_order = BINARY_WORKLOAD_BYTE_ORDER;
+    header.process_count = (uint64_t)count;
+    header.records_offset = (sizeof(header) + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+    header.names_offset = header.records_offset + sizeof(BinaryProcessRecord) * (uint64_t)count;
+    header.names_size = names_size;
+
+    static const char padding[RECORD_ALIGNMENT] = {0};
+    FILE* file = fopen(filepath, "wb");
+    bool ok = file != NULL &&
+              fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(padding, 1, header.records_offset - sizeof(header), file) == header.records_offset - sizeof(header) &&
+              fwrite(records, sizeof(BinaryProcessRecord), count, file) == (size_t)count &&
+              fwrite(names, 1, names_size, file) == names_size;
+    if (file && fclose(file) != 0) ok = false;
+    if (!ok) perror("Error: Failed to write the binary workload");
+
+    free(slots);
+    free(records);
+    free(names);
+    return ok ? 0 : -1;
+}
+
+
+int write_config_text(FILE* file, const Process* processes, int count) {
+    for (int i = 0; i < count; i++) {
+        const Process* process = &processes[i];
+        // Unnamed processes (a header without a name) get a placeholder, as "process  {" would re-parse as '{'
+        int written = (process->name[0] != '\0') ? fprintf(file, "process %s {\n", process->name)
+                                                   : fprintf(file, "process P%d {\n", i + 1);
+        if (written < 0 || fprintf(file, "    arrival_time = %d\n    burst_time = %d\n",
+                                   process->arrival_time, process->burst_time) < 0) {
+            return -1;
+        }
+        if (process->priority != 0 && fprintf(file, "    priority = %d\n", process->priority) < 0) {
+            return -1;
+        }
+        if (fprintf(file, "}\n\n") < 0) return -1;
+    }
+    return 0;
+}
@@ -9,9 +9,9 @@ typedef struct {
 
 // --- Static (Private) Policy Functions ---
 
-static void* fifo_create(int quantum) {
-    // Ignoring the quantum
-    (void)quantum; 
+static void* fifo_create(const PolicyOptions* options) {
+    // Ignoring the options (quantum included)
+    (void)options; 
     FifoPolicyData* policy_data = (FifoPolicyData*)malloc(sizeof(FifoPolicyData));
     if (!policy_data) return NULL;
 
@@ -43,10 +43,6 @@ static Process* fifo_get_next_process(void* policy_data) {
     return queue_dequeue(fifo_data->queue);
 }
 
-static void fifo_tick(void* policy_data) {
-    (void)policy_data; // No-op for FIFO
-}
-
 static bool fifo_needs_reschedule(void* policy_data, Process* running_process) {
     (void)policy_data;
     // When the CPU is idle.
@@ -72,7 +68,6 @@ static const PolicyVTable fifo_vtable = {
     .destroy = fifo_destroy,
     .add_process = fifo_add_process,
     .get_next_process = fifo_get_next_process,
-    .tick = fifo_tick,
     .needs_reschedule = fifo_needs_reschedule,
     .get_quantum = fifo_get_quantum,
     .demote_process = fifo_demote_process
@@ -9,9 +9,9 @@ typedef struct {
 
 // --- Static (Private) Policy Functions ---
 
-static void* lifo_create(int quantum) {
-    // Ignoring the quantum
-    (void)quantum; 
+static void* lifo_create(const PolicyOptions* options) {
+    // Ignoring the options (quantum included)
+    (void)options; 
     LifoPolicyData* policy_data = (LifoPolicyData*)malloc(sizeof(LifoPolicyData));
     if (!policy_data) return NULL;
 
@@ -43,10 +43,6 @@ static Process* lifo_get_next_process(void* policy_data) {
     return stack_pop(lifo_data->ready_stack);
 }
 
-static void lifo_tick(void* policy_data) {
-    (void)policy_data;
-}
-
 static bool lifo_needs_reschedule(void* policy_data, Process* running_process) {
     (void)policy_data;
     // When the CPU is idle.
@@ -72,7 +68,6 @@ static const PolicyVTable lifo_vtable = {
     .destroy = lifo_destroy,
     .add_process = lifo_add_process,
     .get_next_process = lifo_get_next_process,
-    .tick = lifo_tick,
     .needs_reschedule = lifo_needs_reschedule,
     .get_quantum = lifo_get_quantum,
     .demote_process = lifo_demote_process
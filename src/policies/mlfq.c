@@ -2,42 +2,209 @@
 #include "../../headers/data_structures/queue.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <limits.h>
 #include <math.h>
 
-#define MAX_PRIORITY_LEVELS 20
-#define AGING_THRESHOLD 10  // Ticks before promotion
-#define TIME_ALLOTMENT_RATIO 5 // Allotment = Quantum * Ratio
+// Defaults, used for every MlfqParameters field left at zero
+#define DEFAULT_LEVEL_COUNT 20
+#define DEFAULT_AGING_THRESHOLD 10  // Ticks before promotion
+#define DEFAULT_ALLOTMENT_RATIO 5   // Allotment = Quantum * Ratio
 
+// Non-empty levels as a two-level bitmap: bit (level % 64) of words[level / 64] is set
+// while that level's queue holds a process, and bit w of summary is set while words[w] != 0.
+// Finding the highest ready level takes two find-first-set steps for up to 64 * 64 levels.
+#define LEVEL_WORD_BITS 64
+#define LEVEL_WORDS ((MLFQ_MAX_LEVELS + LEVEL_WORD_BITS - 1) / LEVEL_WORD_BITS)
+
+typedef struct {
+    uint64_t summary;
+    uint64_t words[LEVEL_WORDS];
+} LevelBitmap;
+
+// Level 0 is the lowest priority, level_count - 1 the highest
 typedef struct {
-    Queue* queues[MAX_PRIORITY_LEVELS];
-    int base_quantum;
+    Queue** queues;
+    int level_count;
+    int* quantum_for_level;     // Lookup tables filled at creation
+    int* allotment_for_level;
+    int aging_threshold;        // Negative: aging disabled
+    int boost_period;           // 0: no priority boost
+    LevelBitmap ready_levels;
     int current_time;
+    int next_aging_time;    // No waiting process can be promoted before this time (lower bound)
+    int next_boost_time;
+    int last_boost_time;
 } MlfqPolicyData;
 
-static void* mlfq_create(int quantum) {
-    MlfqPolicyData* data = (MlfqPolicyData*)malloc(sizeof(MlfqPolicyData));
+// --- Non-empty level bitmap ---
+
+static inline void level_bitmap_set(LevelBitmap* bitmap, int level) {
+    int word = level / LEVEL_WORD_BITS;
+    bitmap->words[word] |= UINT64_C(1) << (level % LEVEL_WORD_BITS);
+    bitmap->summary |= UINT64_C(1) << word;
+}
+
+static inline void level_bitmap_clear(LevelBitmap* bitmap, int level) {
+    int word = level / LEVEL_WORD_BITS;
+    bitmap->words[word] &= ~(UINT64_C(1) << (level % LEVEL_WORD_BITS));
+    if (bitmap->words[word] == 0) bitmap->summary &= ~(UINT64_C(1) << word);
+}
+
+// Highest level whose queue is non-empty, or -1 if every queue is empty
+static inline int level_bitmap_highest(const LevelBitmap* bitmap) {
+    if (bitmap->summary == 0) return -1;
+    int word = 63 - __builtin_clzll(bitmap->summary);
+    return word * LEVEL_WORD_BITS + 63 - __builtin_clzll(bitmap->words[word]);
+}
+
+// Lowest non-empty level at or above from, or -1 if there is none
+static inline int level_bitmap_next(const LevelBitmap* bitmap, int from) {
+    int word = from / LEVEL_WORD_BITS;
+    if (word >= LEVEL_WORDS) return -1;
+    uint64_t bits = bitmap->words[word] & (~UINT64_C(0) << (from % LEVEL_WORD_BITS));
+    if (bits) return word * LEVEL_WORD_BITS + __builtin_ctzll(bits);
+
+    // Later words: the summary says which one is the next non-empty
+    uint64_t later = (word + 1 < 64) ? bitmap->summary & (~UINT64_C(0) << (word + 1)) : 0;
+    if (!later) return -1;
+    word = __builtin_ctzll(later);
+    return word * LEVEL_WORD_BITS + __builtin_ctzll(bitmap->words[word]);
+}
+
+// Highest non-empty level at or below from, or -1 if there is none
+static inline int level_bitmap_prev(const LevelBitmap* bitmap, int from) {
+    if (from < 0) return -1;
+    int word = from / LEVEL_WORD_BITS;
+    int bit = from % LEVEL_WORD_BITS;
+    uint64_t mask = (bit == 63) ? ~UINT64_C(0) : (UINT64_C(1) << (bit + 1)) - 1;
+    uint64_t bits = bitmap->words[word] & mask;
+    if (bits) return word * LEVEL_WORD_BITS + 63 - __builtin_clzll(bits);
+
+    // Earlier words: the summary says which one is the previous non-empty
+    uint64_t earlier = bitmap->summary & ((UINT64_C(1) << word) - 1);
+    if (!earlier) return -1;
+    word = 63 - __builtin_clzll(earlier);
+    return word * LEVEL_WORD_BITS + 63 - __builtin_clzll(bitmap->words[word]);
+}
+
+// Every queue operation goes through these two so the bitmap always matches the queues.
+// The process's last_active_time must already be stamped with the current time.
+static void level_enqueue(MlfqPolicyData* data, int level, Process* process) {
+    queue_enqueue(data->queues[level], process);
+    level_bitmap_set(&data->ready_levels, level);
+
+    // A process ages once its wait exceeds the aging threshold (the top level never ages)
+    if (level < data->level_count - 1 && data->aging_threshold >= 0) {
+        int aging_time = process->last_active_time + data->aging_threshold + 1;
+        if (aging_time < data->next_aging_time) data->next_aging_time = aging_time;
+    }
+}
+
+static Process* level_dequeue(MlfqPolicyData* data, int level) {
+    Process* process = queue_dequeue(data->queues[level]);
+    if (queue_is_empty(data->queues[level])) level_bitmap_clear(&data->ready_levels, level);
+    return process;
+}
+
+// Reads a per-level table given highest level first, repeating its last entry
+static int table_entry_for_level(const int* table, int count, int level_count, int level) {
+    int index = level_count - 1 - level;
+    return table[(index < count) ? index : count - 1];
+}
+
+// Checks a per-level table: entries must be positive
+static bool valid_level_table(const int* table, int count, const char* what) {
+    if (count < 0 || (count > 0 && !table)) {
+        fprintf(stderr, "MLFQ Policy Error: Invalid %s table.\n", what);
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        if (table[i] <= 0) {
+            fprintf(stderr, "MLFQ Policy Error: %s must be positive (entry %d is %d).\n", what, i + 1, table[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void mlfq_destroy(void* policy_data);
+
+static void* mlfq_create(const PolicyOptions* options) {
+    MlfqParameters defaults = {0};
+    const MlfqParameters* params = (options && options->mlfq) ? options->mlfq : &defaults;
+    int base_quantum = (options && options->quantum > 0) ? options->quantum : 1;
+
+    int level_count = params->level_count ? params->level_count : DEFAULT_LEVEL_COUNT;
+    if (level_count < 1 || level_count > MLFQ_MAX_LEVELS) {
+        fprintf(stderr, "MLFQ Policy Error: Level count must be between 1 and %d (got %d).\n", MLFQ_MAX_LEVELS, level_count);
+        return NULL;
+    }
+    if (!valid_level_table(params->quanta, params->quanta_count, "Quanta")) return NULL;
+    if (!valid_level_table(params->allotments, params->allotment_count, "Allotments")) return NULL;
+    if (params->allotment_ratio < 0 || params->boost_period < 0) {
+        fprintf(stderr, "MLFQ Policy Error: Allotment ratio and boost period cannot be negative.\n");
+        return NULL;
+    }
+
+    MlfqPolicyData* data = (MlfqPolicyData*)calloc(1, sizeof(MlfqPolicyData));
     if (!data) return NULL;
 
-    for (int i = 0; i < MAX_PRIORITY_LEVELS; i++) {
+    data->level_count = level_count;
+    data->queues = (Queue**)calloc(level_count, sizeof(Queue*));
+    data->quantum_for_level = (int*)malloc(level_count * sizeof(int));
+    data->allotment_for_level = (int*)malloc(level_count * sizeof(int));
+    if (!data->queues || !data->quantum_for_level || !data->allotment_for_level) {
+        mlfq_destroy(data);
+        return NULL;
+    }
+    for (int i = 0; i < level_count; i++) {
         data->queues[i] = queue_create();
         if (!data->queues[i]) {
-            for (int j = 0; j < i; j++) queue_destroy(data->queues[j]);
-            free(data);
+            mlfq_destroy(data);
             return NULL;
         }
     }
-    
-    data->base_quantum = (quantum > 0) ? quantum : 1;
+
+    // Quantum table. Default: four equal tiers, from 1x the base quantum at the
+    // top to 4x at the bottom (levels 19-15, 14-10, 9-5, 4-0 with 20 levels)
+    int allotment_ratio = params->allotment_ratio ? params->allotment_ratio : DEFAULT_ALLOTMENT_RATIO;
+    for (int level = 0; level < level_count; level++) {
+        if (params->quanta_count > 0) {
+            data->quantum_for_level[level] = table_entry_for_level(params->quanta, params->quanta_count, level_count, level);
+        } else {
+            int tier = (level_count - 1 - level) * 4 / level_count;
+            data->quantum_for_level[level] = base_quantum * (tier + 1);
+        }
+
+        if (params->allotment_count > 0) {
+            data->allotment_for_level[level] = table_entry_for_level(params->allotments, params->allotment_count, level_count, level);
+        } else {
+            data->allotment_for_level[level] = data->quantum_for_level[level] * allotment_ratio;
+        }
+    }
+
+    data->aging_threshold = params->aging_threshold ? params->aging_threshold : DEFAULT_AGING_THRESHOLD;
+    data->boost_period = params->boost_period;
+    data->ready_levels = (LevelBitmap){0};
     data->current_time = 0;
+    data->next_aging_time = INT_MAX;
+    data->next_boost_time = (data->boost_period > 0) ? data->boost_period : INT_MAX;
+    data->last_boost_time = 0;
     return data;
 }
 
 static void mlfq_destroy(void* policy_data) {
     if (!policy_data) return;
     MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
-    for (int i = 0; i < MAX_PRIORITY_LEVELS; i++) {
-        queue_destroy(data->queues[i]);
+    if (data->queues) {
+        for (int i = 0; i < data->level_count; i++) {
+            if (data->queues[i]) queue_destroy(data->queues[i]);
+        }
     }
+    free(data->queues);
+    free(data->quantum_for_level);
+    free(data->allotment_for_level);
     free(data);
 }
 
@@ -45,9 +212,9 @@ static void mlfq_add_process(void* policy_data, Process* process) {
     if (!policy_data || !process) return;
     MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
     
-    // Initial placement: Config priority or clamped to MAX-1
+    // Initial placement: Config priority or clamped to the top level
     int level = process->priority;
-    if (level >= MAX_PRIORITY_LEVELS) level = MAX_PRIORITY_LEVELS - 1;
+    if (level >= data->level_count) level = data->level_count - 1;
     if (level < 0) level = 0;
     
     process->current_queue_level = level;
@@ -55,94 +222,76 @@ static void mlfq_add_process(void* policy_data, Process* process) {
     process->time_spent_at_current_level = 0;
     process->last_active_time = data->current_time;
     
-    queue_enqueue(data->queues[level], process);
+    level_enqueue(data, level, process);
 }
 
 static Process* mlfq_get_next_process(void* policy_data) {
     if (!policy_data) return NULL;
     MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
 
-    // Scan from highest priority (MAX-1) down to 0
-    for (int i = MAX_PRIORITY_LEVELS - 1; i >= 0; i--) {
-        if (!queue_is_empty(data->queues[i])) {
-            Process* p = queue_dequeue(data->queues[i]);
-            // Update last active time for aging check later
-            // But real update happens when it runs
-            return p;
-        }
-    }
-    return NULL;
-}
-
-// Helper: Calculate Quantum for a level
-// Higher level = Higher priority = Shorter Quantum
-// Level 0 (Lowest) = Longest Quantum
-// Formula: Q = base * 2^(MAX - 1 - level)
-// But to keep it reasonable, let's just do base * (MAX - level) or similar
-// Or simpler: Top half gets base, Bottom half gets base*2, etc.
-// Let's stick to the user's plan: "Top = Short, Bottom = Long"
-// Q_i = base * 2^(MAX_LEVELS - 1 - i) might be too huge.
-// Let's use a simpler exponential scale but clamped.
-// 20 levels total. Split into 4 tiers of 5 levels each.
-static int get_quantum_for_level(MlfqPolicyData* data, int level) {
-    if (level >= 15) return data->base_quantum * 1;
-    if (level >= 10) return data->base_quantum * 2;
-    if (level >= 5)  return data->base_quantum * 3;
-    return data->base_quantum * 4;
+    // Highest non-empty level, straight from the bitmap
+    int level = level_bitmap_highest(&data->ready_levels);
+    if (level < 0) return NULL;
+    // last_active_time is refreshed when the process runs and is demoted
+    return level_dequeue(data, level);
 }
 
-static int get_allotment_for_level(MlfqPolicyData* data, int level) {
-    return get_quantum_for_level(data, level) * TIME_ALLOTMENT_RATIO;
+// Priority boost: every waiting process moves to the top level, lower levels
+// appended in order from the highest one down
+static void boost_all_levels(MlfqPolicyData* data) {
+    int top = data->level_count - 1;
+    for (int i = level_bitmap_prev(&data->ready_levels, top - 1); i >= 0;
+         i = level_bitmap_prev(&data->ready_levels, i - 1)) {
+        while (!queue_is_empty(data->queues[i])) {
+            Process* p = level_dequeue(data, i);
+            p->current_queue_level = top;
+            p->current_quantum_runtime = 0;
+            p->time_spent_at_current_level = 0;
+            p->last_active_time = data->current_time;
+            level_enqueue(data, top, p);
+        }
+    }
+    data->last_boost_time = data->current_time;
 }
 
 static void mlfq_tick(void* policy_data) {
     if (!policy_data) return;
     MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
     data->current_time++;
-    
-    // Aging Check: Iterate all queues except the top one
-    for (int i = 0; i < MAX_PRIORITY_LEVELS - 1; i++) {
-        // We can't iterate the queue easily without exposing internals or de-queueing
-        // This is a limitation of the Queue ADT.
-        // PROPER APPROACH for Queue ADT: 
-        // We can only check the head. If head is starving, move it. 
-        // Or we assume the "Process" struct is updated externally? No.
-        
-        // Workaround: Rotate the queue? Expensive.
-        // Efficient Workaround: Check Head. If head is old, promote. Repeat until head is young.
-        
-        int size = 0; // Unknown size... 
-        // Since we can't iterate, we will trust the Scheduler Engine calls us enough.
-        // Actually, we can peek/rotate if we modify Queue, but we are in policy.
-        
-        // Optimization: Only check queues that have items.
-        // Since we lack a 'size' or iterator, we will do a "Best Effort" aging on the head.
-        if (!queue_is_empty(data->queues[i])) {
-            int count = queue_size(data->queues[i]);
-            // Full Scan: Process exactly 'count' items.
-            // Items that are not promoted are re-enqueued.
-            // Items that are promoted are moved to higher queue.
-            // This preserves the relative order of the non-promoted items (rotation).
-            // Since we rotate everyone, the order A,B,C -> B,C,A -> C,A,B -> A,B,C is restored (if none promoted)
-            
-            for (int k = 0; k < count; k++) {
-                 Process* p = queue_dequeue(data->queues[i]);
-                 int wait_time = data->current_time - p->last_active_time;
-                 
-                 if (wait_time > AGING_THRESHOLD) {
-                     // Promote!
-                     p->current_queue_level++;
-                     p->current_quantum_runtime = 0;
-                     p->time_spent_at_current_level = 0;
-                     p->last_active_time = data->current_time; // Reset aging timer
-                     queue_enqueue(data->queues[p->current_queue_level], p);
-                 } else {
-                     // Not old enough, put back
-                     queue_enqueue(data->queues[i], p);
-                 }
-            }
+
+    if (data->current_time >= data->next_boost_time) {
+        boost_all_levels(data);
+        data->next_boost_time += data->boost_period;
+    }
+
+    // Nothing can have aged yet: the common case costs one comparison
+    if (data->current_time < data->next_aging_time) return;
+
+    // Every enqueue stamps last_active_time with the (monotonic) policy clock,
+    // so each queue is ordered by last_active_time and the starving processes
+    // form a prefix of it. Promoting that prefix, lowest level first, gives the
+    // same queues as checking every waiting process.
+    int next_aging_time = INT_MAX;
+    for (int i = level_bitmap_next(&data->ready_levels, 0);
+         i >= 0 && i < data->level_count - 1;
+         i = level_bitmap_next(&data->ready_levels, i + 1)) {
+        Process* p = queue_peek(data->queues[i]);
+        while (p && data->current_time - p->last_active_time > data->aging_threshold) {
+            // Promote!
+            level_dequeue(data, i);
+            p->current_queue_level++;
+            p->current_quantum_runtime = 0;
+            p->time_spent_at_current_level = 0;
+            p->last_active_time = data->current_time; // Reset aging timer
+            level_enqueue(data, p->current_queue_level, p);
+            p = queue_peek(data->queues[i]);
+        }
+        if (p && p->last_active_time + data->aging_threshold + 1 < next_aging_time) {
+            next_aging_time = p->last_active_time + data->aging_threshold + 1;
         }
     }
+    // Exact again: the minimum over the remaining heads
+    data->next_aging_time = next_aging_time;
 }
 
 static bool mlfq_needs_reschedule(void* policy_data, Process* running_process) {
@@ -155,17 +304,13 @@ static bool mlfq_needs_reschedule(void* policy_data, Process* running_process) {
     int level = running_process->current_queue_level;
 
     // 2. Preemption: Check if ANY higher queue has a process
-    for (int i = MAX_PRIORITY_LEVELS - 1; i > level; i--) {
-        if (!queue_is_empty(data->queues[i])) return true;
-    }
+    if (level_bitmap_highest(&data->ready_levels) > level) return true;
 
     // 3. Quantum / Allotment Expiration
-    int q = get_quantum_for_level(data, level);
-    if (running_process->current_quantum_runtime >= q) return true;
+    if (running_process->current_quantum_runtime >= data->quantum_for_level[level]) return true;
     
     // 4. Anti-Gaming Allotment check (though demotion happens in demote_process)
-    int allotment = get_allotment_for_level(data, level);
-    if (running_process->time_spent_at_current_level >= allotment) return true;
+    if (running_process->time_spent_at_current_level >= data->allotment_for_level[level]) return true;
 
     return false;
 }
@@ -173,7 +318,7 @@ static bool mlfq_needs_reschedule(void* policy_data, Process* running_process) {
 static int mlfq_get_quantum(void* policy_data, Process* process) {
     if (!policy_data || !process) return 0;
     MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
-    return get_quantum_for_level(data, process->current_queue_level);
+    return data->quantum_for_level[process->current_queue_level];
 }
 
 static void mlfq_demote_process(void* policy_data, Process* process) {
@@ -181,22 +326,29 @@ static void mlfq_demote_process(void* policy_data, Process* process) {
     MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
 
     int level = process->current_queue_level;
+
+    // A process that was running during a priority boost joins the top level now
+    if (process->last_active_time < data->last_boost_time) {
+        process->last_active_time = data->current_time;
+        process->current_queue_level = data->level_count - 1;
+        process->current_quantum_runtime = 0;
+        process->time_spent_at_current_level = 0;
+        level_enqueue(data, data->level_count - 1, process);
+        return;
+    }
     
     // Update total time spent at this level
     // This function is called when a process yields or is preempted
     process->time_spent_at_current_level += process->current_quantum_runtime;
     process->last_active_time = data->current_time; // It just ran, so it's active
     
-    int allotment = get_allotment_for_level(data, level);
-    int quantum = get_quantum_for_level(data, level);
-    
     // Check Demotion Criteria:
     // 1. Used up full quantum in one go? (Normal RR logic)
     // 2. Used up total allotment? (Anti-gaming logic)
     
     bool demote = false;
-    if (process->current_quantum_runtime >= quantum) demote = true;
-    if (process->time_spent_at_current_level >= allotment) demote = true;
+    if (process->current_quantum_runtime >= data->quantum_for_level[level]) demote = true;
+    if (process->time_spent_at_current_level >= data->allotment_for_level[level]) demote = true;
 
     if (demote && level > 0) {
         level--; // Moves down (remember 0 is bottom)
@@ -206,7 +358,39 @@ static void mlfq_demote_process(void* policy_data, Process* process) {
     process->current_queue_level = level;
     process->current_quantum_runtime = 0; // Reset runtime
     
-    queue_enqueue(data->queues[level], process);
+    level_enqueue(data, level, process);
+}
+
+static int mlfq_ticks_until_event(void* policy_data, Process* running_process) {
+    if (!policy_data) return 0;
+    MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
+    (void)running_process; // Quantum and allotment expiry are checked by the engine / needs_reschedule
+
+    // Every enqueue stamps last_active_time with the (monotonic) policy clock,
+    // so each queue is ordered by last_active_time and its head ages first.
+    int ticks = POLICY_NO_EVENT;
+    if (data->aging_threshold >= 0) {
+        for (int i = level_bitmap_next(&data->ready_levels, 0);
+             i >= 0 && i < data->level_count - 1;
+             i = level_bitmap_next(&data->ready_levels, i + 1)) {
+            Process* head = queue_peek(data->queues[i]);
+            // The head is promoted by the tick that makes the wait exceed the aging threshold
+            int quiet = head->last_active_time + data->aging_threshold - data->current_time;
+            if (quiet < ticks) ticks = quiet;
+        }
+    }
+    // The boost happens on the tick that reaches next_boost_time
+    if (data->next_boost_time != INT_MAX && data->next_boost_time - 1 - data->current_time < ticks) {
+        ticks = data->next_boost_time - 1 - data->current_time;
+    }
+    return (ticks > 0) ? ticks : 0;
+}
+
+static void mlfq_advance(void* policy_data, int ticks) {
+    if (!policy_data) return;
+    MlfqPolicyData* data = (MlfqPolicyData*)policy_data;
+    // Only valid inside the quiet window reported above: no process can age and no boost is due meanwhile
+    data->current_time += ticks;
 }
 
 static const PolicyVTable mlfq_vtable = {
@@ -218,7 +402,9 @@ static const PolicyVTable mlfq_vtable = {
     .tick = mlfq_tick,
     .needs_reschedule = mlfq_needs_reschedule,
     .get_quantum = mlfq_get_quantum,
-    .demote_process = mlfq_demote_process
+    .demote_process = mlfq_demote_process,
+    .ticks_until_event = mlfq_ticks_until_event,
+    .advance = mlfq_advance
 };
 
 const PolicyVTable* mlfq_get_vtable() {
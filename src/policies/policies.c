@@ -1,4 +1,5 @@
 #include "../../headers/policies/policies.h"
+#include <pthread.h>
 
 #ifdef HAVE_FIFO_POLICY
 #include "../../headers/policies/fifo.h"
@@ -35,7 +36,12 @@
 // --- Internal Policy Registry ---
 
 /**
- * @brief Registers all available scheduling policies with the policy interface.
+ * @brief Makes sure the built-in policies are registered exactly once per process.
+ */
+static pthread_once_t builtin_policies_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Registers all built-in scheduling policies with the policy interface.
  *
  * This function automatically registers only the policies that are currently
  * compiled into the simulator. Policies are detected at build-time by the
@@ -47,7 +53,7 @@
  * To add a new policy, create both files and add the policy name to the
  * POLICY_NAMES list in the Makefile.
  */
-void register_all_policies() {
+static void register_builtin_policies(void) {
     #ifdef HAVE_FIFO_POLICY
     register_policy(fifo_get_vtable());
     #endif
@@ -80,3 +86,13 @@ void register_all_policies() {
     register_policy(preemptive_priority_get_vtable());
     #endif
 }
+
+/**
+ * @brief Registers all available scheduling policies with the policy interface.
+ *
+ * Idempotent and thread-safe: the first call registers the built-in policies,
+ * later calls (from any thread) return once that registration is complete.
+ */
+void register_all_policies() {
+    pthread_once(&builtin_policies_once, register_builtin_policies);
+}
@@ -1,33 +1,24 @@
 #include "../../headers/policies/priority.h"
-#include "../../headers/data_structures/max_heap.h"
+#include "../../headers/data_structures/heap.h"
 #include <stdlib.h>
 
 // --- Internal Priority Policy Data Structure ---
 typedef struct {
-    MaxHeap* heap;
+    Heap* heap;
 } PriorityPolicyData;
 
-// --- Comparator for the MaxHeap ---
-static int priority_comparator(Process* a, Process* b) {
-    Process* p1 = (Process*)a;
-    Process* p2 = (Process*)b;
-    // Higher priority value is greater
-    if (p1->priority != p2->priority) {
-        return p1->priority - p2->priority;
-    }
-    // Tie-break with arrival time: earlier arrival is greater
-    return p2->arrival_time - p1->arrival_time;
-}
+// --- Ready Queue Order ---
+// Highest priority value first; ties go to the earlier arrival (built-in heap key, compared inline)
 
 // --- Static (Private) Policy Functions ---
 
-static void* priority_create(int quantum) {
-    // Ignoring the quantum
-    (void)quantum; 
+static void* priority_create(const PolicyOptions* options) {
+    // Ignoring the options (quantum included)
+    (void)options; 
     PriorityPolicyData* policy_data = (PriorityPolicyData*)malloc(sizeof(PriorityPolicyData));
     if (!policy_data) return NULL;
 
-    policy_data->heap = max_heap_create(priority_comparator);
+    policy_data->heap = heap_create_keyed(HEAP_KEY_PRIORITY);
     if (!policy_data->heap) {
         free(policy_data);
         return NULL;
@@ -38,25 +29,21 @@ static void* priority_create(int quantum) {
 static void priority_destroy(void* policy_data) {
     if (!policy_data) return;
     PriorityPolicyData* priority_data = (PriorityPolicyData*)policy_data;
-    max_heap_destroy(priority_data->heap);
+    heap_destroy(priority_data->heap);
     free(priority_data);
 }
 
 static void priority_add_process(void* policy_data, Process* process) {
     if (!policy_data || !process) return;
     PriorityPolicyData* priority_data = (PriorityPolicyData*)policy_data;
-    max_heap_push(priority_data->heap, process);
+    heap_push(priority_data->heap, process);
 }
 
 static Process* priority_get_next_process(void* policy_data) {
     if (!policy_data) return NULL;
     PriorityPolicyData* priority_data = (PriorityPolicyData*)policy_data;
-    if (max_heap_is_empty(priority_data->heap)) return NULL;
-    return max_heap_pop(priority_data->heap);
-}
-
-static void priority_tick(void* policy_data) {
-    (void)policy_data;
+    if (heap_is_empty(priority_data->heap)) return NULL;
+    return heap_pop(priority_data->heap);
 }
 
 static bool priority_needs_reschedule(void* policy_data, Process* running_process) {
@@ -84,7 +71,6 @@ static const PolicyVTable priority_vtable = {
     .destroy = priority_destroy,
     .add_process = priority_add_process,
     .get_next_process = priority_get_next_process,
-    .tick = priority_tick,
     .needs_reschedule = priority_needs_reschedule,
     .get_quantum = priority_get_quantum,
     .demote_process = priority_demote_process
@@ -10,7 +10,7 @@ typedef struct {
 
 // --- Static (Private) Policy Functions ---
 
-static void* rr_create(int quantum) {
+static void* rr_create(const PolicyOptions* options) {
     RrPolicyData* policy_data = (RrPolicyData*)malloc(sizeof(RrPolicyData));
     if (!policy_data) return NULL;
 
@@ -21,7 +21,7 @@ static void* rr_create(int quantum) {
     }
 
     // Making the quantum atleast 1
-    policy_data->quantum = (quantum > 0) ? quantum : 1;
+    policy_data->quantum = (options && options->quantum > 0) ? options->quantum : 1;
     return policy_data;
 }
 
@@ -45,10 +45,6 @@ static Process* rr_get_next_process(void* policy_data) {
     return queue_dequeue(rr_data->ready_queue);
 }
 
-static void rr_tick(void* policy_data) {
-    (void)policy_data;
-}
-
 static bool rr_needs_reschedule(void* policy_data, Process* running_process) {
     if (!policy_data) return true;
     RrPolicyData* rr_data = (RrPolicyData*)policy_data;
@@ -72,6 +68,14 @@ static void rr_demote_process(void* policy_data, Process* process) {
     rr_add_process(rr_data, process);
 }
 
+static int rr_ticks_until_event(void* policy_data, Process* running_process) {
+    if (!policy_data || !running_process) return 0;
+    RrPolicyData* rr_data = (RrPolicyData*)policy_data;
+    // The only timer is the running process's time slice
+    int left = rr_data->quantum - running_process->current_quantum_runtime;
+    return (left > 0) ? left : 0;
+}
+
 // --- VTable Definition ---
 
 static const PolicyVTable rr_vtable = {
@@ -80,10 +84,10 @@ static const PolicyVTable rr_vtable = {
     .destroy = rr_destroy,
     .add_process = rr_add_process,
     .get_next_process = rr_get_next_process,
-    .tick = rr_tick,
     .needs_reschedule = rr_needs_reschedule,
     .get_quantum = rr_get_quantum,
-    .demote_process = rr_demote_process
+    .demote_process = rr_demote_process,
+    .ticks_until_event = rr_ticks_until_event
 };
 
 // --- Public VTable Accessor ---
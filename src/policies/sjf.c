@@ -1,28 +1,24 @@
 #include "../../headers/policies/sjf.h"
-#include "../../headers/data_structures/min_heap.h"
+#include "../../headers/data_structures/heap.h"
 #include <stdlib.h>
 
 // --- Internal SJF Policy Data Structure ---
 typedef struct {
-    MinHeap* heap;
+    Heap* heap;
 } SjfPolicyData;
 
-// --- Comparator for the MinHeap ---
-static int sjf_comparator(Process* a, Process* b) {
-    Process* p1 = (Process*)a;
-    Process* p2 = (Process*)b;
-    return p1->burst_time - p2->burst_time;
-}
+// --- Ready Queue Order ---
+// Shortest burst first; ties go to the earlier arrival (built-in heap key, compared inline)
 
 // --- Static (Private) Policy Functions ---
 
-static void* sjf_create(int quantum) {
-    // Ignoring the quantum
-    (void)quantum;  
+static void* sjf_create(const PolicyOptions* options) {
+    // Ignoring the options (quantum included)
+    (void)options;  
     SjfPolicyData* policy_data = (SjfPolicyData*)malloc(sizeof(SjfPolicyData));
     if (!policy_data) return NULL;
 
-    policy_data->heap = min_heap_create(sjf_comparator);
+    policy_data->heap = heap_create_keyed(HEAP_KEY_BURST);
     if (!policy_data->heap) {
         free(policy_data);
         return NULL;
@@ -33,25 +29,21 @@ static void* sjf_create(int quantum) {
 static void sjf_destroy(void* policy_data) {
     if (!policy_data) return;
     SjfPolicyData* sjf_data = (SjfPolicyData*)policy_data;
-    min_heap_destroy(sjf_data->heap);
+    heap_destroy(sjf_data->heap);
     free(sjf_data);
 }
 
 static void sjf_add_process(void* policy_data, Process* process) {
     if (!policy_data || !process) return;
     SjfPolicyData* sjf_data = (SjfPolicyData*)policy_data;
-    min_heap_push(sjf_data->heap, process);
+    heap_push(sjf_data->heap, process);
 }
 
 static Process* sjf_get_next_process(void* policy_data) {
     if (!policy_data) return NULL;
     SjfPolicyData* sjf_data = (SjfPolicyData*)policy_data;
-    if (min_heap_is_empty(sjf_data->heap)) return NULL;
-    return min_heap_pop(sjf_data->heap);
-}
-
-static void sjf_tick(void* policy_data) {
-    (void)policy_data;
+    if (heap_is_empty(sjf_data->heap)) return NULL;
+    return heap_pop(sjf_data->heap);
 }
 
 static bool sjf_needs_reschedule(void* policy_data, Process* running_process) {
@@ -79,7 +71,6 @@ static const PolicyVTable sjf_vtable = {
     .destroy = sjf_destroy,
     .add_process = sjf_add_process,
     .get_next_process = sjf_get_next_process,
-    .tick = sjf_tick,
     .needs_reschedule = sjf_needs_reschedule,
     .get_quantum = sjf_get_quantum,
     .demote_process = sjf_demote_process
@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "../headers/data_structures/data_structures.h"
+
+#define PROCESS_COUNT 100
+
+void test_queue_ring_buffer() {
+    printf("--- Running Queue Test (ring buffer) ---\n");
+    Process processes[PROCESS_COUNT];
+    Queue* q = queue_create();
+    assert(q != NULL);
+    assert(queue_is_empty(q));
+    assert(queue_dequeue(q) == NULL);
+    assert(queue_peek(q) == NULL);
+
+    // Rotate a partially full queue so the live range wraps around the buffer end
+    for (int i = 0; i < 10; i++) queue_enqueue(q, &processes[i]);
+    for (int round = 0; round < 37; round++) {
+        queue_enqueue(q, queue_dequeue(q));
+    }
+    for (int i = 0; i < 10; i++) {
+        assert(queue_dequeue(q) == &processes[(i + 37) % 10]);
+    }
+    assert(queue_is_empty(q));
+    printf("  ✅ FIFO order kept across wrap-around.\n");
+
+    // Grow while wrapped: order must survive the copy into the larger buffer
+    for (int i = 0; i < 12; i++) queue_enqueue(q, &processes[i]);
+    for (int i = 0; i < 8; i++) assert(queue_dequeue(q) == &processes[i]);
+    for (int i = 12; i < PROCESS_COUNT; i++) queue_enqueue(q, &processes[i]);
+    assert(queue_size(q) == PROCESS_COUNT - 8);
+    assert(queue_peek(q) == &processes[8]);
+    for (int i = 8; i < PROCESS_COUNT; i++) assert(queue_dequeue(q) == &processes[i]);
+    assert(queue_is_empty(q) && queue_size(q) == 0);
+    printf("  ✅ FIFO order kept across growth.\n");
+
+    queue_destroy(q);
+    printf("\nTEST PASSED: Queue.\n\n\n");
+}
+
+void test_stack_array() {
+    printf("--- Running Stack Test (growable array) ---\n");
+    Process processes[PROCESS_COUNT];
+    Stack* s = stack_create();
+    assert(s != NULL);
+    assert(stack_is_empty(s));
+    assert(stack_pop(s) == NULL);
+    assert(stack_peek(s) == NULL);
+
+    for (int i = 0; i < PROCESS_COUNT; i++) stack_push(s, &processes[i]);
+    assert(stack_peek(s) == &processes[PROCESS_COUNT - 1]);
+    for (int i = PROCESS_COUNT - 1; i >= 0; i--) assert(stack_pop(s) == &processes[i]);
+    assert(stack_is_empty(s));
+    printf("  ✅ LIFO order kept across growth.\n");
+
+    // Destroying a non-empty stack must not touch the processes
+    stack_push(s, &processes[0]);
+    stack_destroy(s);
+    printf("\nTEST PASSED: Stack.\n\n\n");
+}
+
+// Pops everything and checks each process may come out before the next one
+static void assert_heap_order(Heap* h, int expected, bool (*in_order)(const Process*, const Process*)) {
+    assert(heap_size(h) == expected);
+    Process* previous = heap_pop(h);
+    for (int i = 1; i < expected; i++) {
+        Process* next = heap_pop(h);
+        assert(next != NULL);
+        assert(in_order(previous, next));
+        previous = next;
+    }
+    assert(heap_is_empty(h) && heap_pop(h) == NULL);
+}
+
+static bool burst_in_order(const Process* a, const Process* b) {
+    if (a->burst_time != b->burst_time) return a->burst_time < b->burst_time;
+    if (a->arrival_time != b->arrival_time) return a->arrival_time < b->arrival_time;
+    return a->original_index < b->original_index;
+}
+
+static bool priority_recency_in_order(const Process* a, const Process* b) {
+    if (a->priority != b->priority) return a->priority > b->priority;
+    if (a->last_executed_time != b->last_executed_time) return a->last_executed_time < b->last_executed_time;
+    if (a->arrival_time != b->arrival_time) return a->arrival_time < b->arrival_time;
+    return a->original_index < b->original_index;
+}
+
+static int burst_comparator(Process* a, Process* b) {
+    return burst_in_order(a, b) ? -1 : (burst_in_order(b, a) ? 1 : 0);
+}
+
+void test_heap_orders() {
+    printf("--- Running Heap Test (4-ary, built-in keys and comparator) ---\n");
+    Process processes[PROCESS_COUNT];
+    srand(7);
+    for (int i = 0; i < PROCESS_COUNT; i++) {
+        processes[i].original_index = i;
+        processes[i].arrival_time = rand() % 10;
+        processes[i].burst_time = 1 + rand() % 5;
+        processes[i].priority = rand() % 4;
+        processes[i].last_executed_time = rand() % 3 - 1;
+    }
+
+    Heap* keyed = heap_create_keyed(HEAP_KEY_BURST);
+    Heap* custom = heap_create(burst_comparator);
+    Heap* priority = heap_create_keyed(HEAP_KEY_PRIORITY_RECENCY);
+    assert(keyed && custom && priority);
+    assert(heap_create_keyed(HEAP_KEY_CUSTOM) == NULL && heap_create(NULL) == NULL);
+    assert(heap_peek(keyed) == NULL);
+
+    // Interleave pops with pushes so sifts run on partially filled levels
+    for (int i = 0; i < PROCESS_COUNT; i++) {
+        heap_push(keyed, &processes[i]);
+        heap_push(custom, &processes[i]);
+        heap_push(priority, &processes[i]);
+        if (i % 3 == 2) {
+            Process* a = heap_pop(keyed);
+            Process* b = heap_pop(custom);
+            assert(a == b);
+            heap_push(keyed, a);
+            heap_push(custom, b);
+        }
+    }
+    for (int i = 0; i < PROCESS_COUNT; i++) {
+        assert(!burst_in_order(&processes[i], heap_peek(keyed)));
+    }
+    assert_heap_order(keyed, PROCESS_COUNT, burst_in_order);
+    assert_heap_order(custom, PROCESS_COUNT, burst_in_order);
+    assert_heap_order(priority, PROCESS_COUNT, priority_recency_in_order);
+    printf("  ✅ Pops come out in key order, ties broken by arrival then id.\n");
+
+    heap_destroy(keyed);
+    heap_destroy(custom);
+    heap_destroy(priority);
+    printf("\nTEST PASSED: Heap.\n\n\n");
+}
+
+void test_timer_wheel() {
+    printf("--- Running Timer Wheel Test (hierarchical, cascading) ---\n");
+    TimerNode timers[PROCESS_COUNT];
+    long long expected[PROCESS_COUNT];
+    TimerWheel* wheel = timer_wheel_create(5);
+    assert(wheel != NULL);
+    assert(timer_wheel_next_expiry(wheel) == TIMER_WHEEL_NEVER);
+    assert(timer_wheel_pop_expired(wheel) == NULL);
+
+    // Expiries spread over every level, some sharing a tick
+    srand(11);
+    for (int i = 0; i < PROCESS_COUNT; i++) {
+        timer_init(&timers[i]);
+        assert(!timer_is_armed(&timers[i]));
+        long long span = 1LL << (rand() % 34);
+        expected[i] = 5 + rand() % span;
+        timer_wheel_arm(wheel, &timers[i], expected[i]);
+    }
+    // Re-arming moves a timer; cancelling removes it
+    expected[0] = 5 + 4097;
+    timer_wheel_arm(wheel, &timers[0], expected[0]);
+    timer_wheel_cancel(wheel, &timers[1]);
+    timer_wheel_cancel(wheel, &timers[1]);
+    expected[1] = -1;
+    assert(timer_wheel_size(wheel) == PROCESS_COUNT - 1);
+
+    // Jumping from expiry to expiry fires every timer exactly on time, in time order
+    int fired = 0;
+    long long last = 0;
+    while (timer_wheel_next_expiry(wheel) != TIMER_WHEEL_NEVER) {
+        long long next = timer_wheel_next_expiry(wheel);
+        long long earliest = -1;
+        for (int i = 0; i < PROCESS_COUNT; i++) {
+            if (expected[i] >= 0 && (earliest < 0 || expected[i] < earliest)) earliest = expected[i];
+        }
+        assert(next == earliest && next >= last);
+        timer_wheel_advance(wheel, next);
+        TimerNode* timer;
+        while ((timer = timer_wheel_pop_expired(wheel)) != NULL) {
+            int i = (int)(timer - timers);
+            assert(expected[i] == next && !timer_is_armed(timer));
+            expected[i] = -1;
+            fired++;
+        }
+        last = next;
+    }
+    assert(fired == PROCESS_COUNT - 1 && timer_wheel_size(wheel) == 0);
+    printf("  ✅ Timers fire in expiry order after cascading.\n");
+
+    timer_wheel_destroy(wheel);
+    printf("\nTEST PASSED: Timer wheel.\n\n\n");
+}
+
+int main() {
+    printf("--- Running All Data Structure Tests ---\n\n");
+    test_queue_ring_buffer();
+    test_stack_array();
+    test_heap_orders();
+    test_timer_wheel();
+    printf("\nTEST PASSED: All data structure tests completed.\n");
+    return 0;
+}
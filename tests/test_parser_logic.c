@@ -2,7 +2,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <unistd.h>
 #include "../headers/parser/config_parser.h"
+#include "../headers/parser/workload_binary.h"
 #include "../headers/data_structures/process.h"
 
 // A utility function to check process values and print errors
@@ -15,6 +17,248 @@ void check_process(const Process* p, const char* name, int arrival, int burst, i
     printf("  ✅ Verified Process %s\n", name);
 }
 
+// Parses the same text through the in-memory and the streaming paths and checks they agree
+static Process* parse_both_ways(const char* text, int* process_count) {
+    int stream_count = -1;
+    FILE* stream = fmemopen((void*)text, strlen(text), "r");
+    assert(stream != NULL);
+    Process* streamed = parse_config_stream(stream, &stream_count);
+    fclose(stream);
+
+    Process* buffered = parse_config_buffer(text, strlen(text), process_count);
+    assert((buffered == NULL) == (streamed == NULL));
+    if (buffered) {
+        assert(*process_count == stream_count);
+        assert(memcmp(buffered, streamed, sizeof(Process) * stream_count) == 0);
+    }
+    free(streamed);
+    return buffered;
+}
+
+static void test_parse_paths_agree() {
+    printf("Asserting both parser paths accept the same grammar...\n");
+    int count = 0;
+
+    // Comments, CRLF line endings, tabs and signed values
+    Process* processes = parse_both_ways(
+        "# header\r\n\"\"\"\r\nprocess Hidden {\r\n\"\"\"\r\n"
+        "process A { # trailing\r\n\tarrival_time\t=\t3 # note\r\n burst_time = +7\r\npriority=2x\r\n}\r\n"
+        "process B {\narrival_time=0\nburst_time=1\n}", &count);
+    assert(processes != NULL && count == 2);
+    check_process(&processes[0], "A", 3, 7, 2);
+    check_process(&processes[1], "B", 0, 1, 0);
+    free(processes);
+
+    // Names are cut at 31 characters
+    processes = parse_both_ways("process ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 {\narrival_time=1\nburst_time=1\n}\n", &count);
+    assert(processes != NULL && count == 1);
+    check_process(&processes[0], "ABCDEFGHIJKLMNOPQRSTUVWXYZ01234", 1, 1, 0);
+    free(processes);
+
+    // Lines longer than 255 bytes are read in 255-byte pieces
+    char long_line[600];
+    snprintf(long_line, sizeof(long_line), "process L {\narrival_time = 4%300s\nburst_time = 2\n}\n", "");
+    processes = parse_both_ways(long_line, &count);
+    assert(processes != NULL && count == 1);
+    check_process(&processes[0], "L", 4, 2, 0);
+    free(processes);
+
+    // Errors stay errors
+    assert(parse_both_ways("process A {\narrival_time=1\n", &count) == NULL);
+    assert(parse_both_ways("process A {\narrival_time=1\nburst_time=0\n}\n", &count) == NULL);
+    assert(parse_both_ways("process A {\nspeed=1\n}\n", &count) == NULL);
+    assert(parse_both_ways("\"\"\"\nnever closed\n", &count) == NULL);
+    printf("  ✅ Buffer and stream parsers agree.\n");
+}
+
+// Runs a parse with stderr captured into `errors`
+static Process* parse_capturing_errors(const char* text, int thread_count, int* process_count, char* errors, size_t errors_size) {
+    fflush(stderr);
+    int saved_stderr = dup(STDERR_FILENO);
+    FILE* capture = tmpfile();
+    assert(saved_stderr >= 0 && capture != NULL);
+    dup2(fileno(capture), STDERR_FILENO);
+
+    Process* processes = parse_config_buffer_parallel(text, strlen(text), process_count, thread_count);
+
+    fflush(stderr);
+    dup2(saved_stderr, STDERR_FILENO);
+    close(saved_stderr);
+    rewind(capture);
+    size_t length = fread(errors, 1, errors_size - 1, capture);
+    errors[length] = '\0';
+    fclose(capture);
+    return processes;
+}
+
+static void test_parallel_parse() {
+    printf("Asserting the threaded parser matches the single-threaded one...\n");
+
+    // 40 processes; a comment block holding "}" lines spans several chunk cuts
+    char text[8192];
+    size_t length = 0;
+    for (int i = 0; i < 40; i++) {
+        if (i == 12) length += snprintf(text + length, sizeof(text) - length, "\"\"\"\nprocess Fake {\n}\n}\n}\n}\n\"\"\"\n");
+        length += snprintf(text + length, sizeof(text) - length,
+                           "process P%d {\n  arrival_time = %d\n  burst_time = %d # burst\n}\n\n", i, i / 3, 1 + i % 7);
+    }
+
+    char sequential_errors[512], parallel_errors[512];
+    int sequential_count = 0;
+    Process* sequential = parse_capturing_errors(text, 1, &sequential_count, sequential_errors, sizeof(sequential_errors));
+    assert(sequential != NULL && sequential_count == 40);
+    for (int threads = 2; threads <= 16; threads *= 2) {
+        int count = 0;
+        Process* parallel = parse_capturing_errors(text, threads, &count, parallel_errors, sizeof(parallel_errors));
+        assert(parallel != NULL && count == sequential_count);
+        assert(memcmp(parallel, sequential, sizeof(Process) * count) == 0);
+        for (int i = 0; i < count; i++) assert(parallel[i].original_index == i);
+        free(parallel);
+    }
+    free(sequential);
+
+    // An error late in the file is reported once, with its line number in the whole file
+    char* bad_key = strstr(text, "process P33 {\n  arrival_time");
+    assert(bad_key != NULL);
+    memcpy(bad_key + strlen("process P33 {\n  "), "arrivXl_time", 12);
+    sequential = parse_capturing_errors(text, 1, &sequential_count, sequential_errors, sizeof(sequential_errors));
+    assert(sequential == NULL && strstr(sequential_errors, "Unknown key 'arrivXl_time'") != NULL);
+    for (int threads = 2; threads <= 16; threads *= 2) {
+        int count = 0;
+        assert(parse_capturing_errors(text, threads, &count, parallel_errors, sizeof(parallel_errors)) == NULL);
+        assert(strcmp(parallel_errors, sequential_errors) == 0);
+    }
+    printf("  ✅ %s", sequential_errors);
+    printf("  ✅ Threaded results, order and errors match.\n");
+}
+
+static void test_binary_workload() {
+    printf("Asserting binary workloads round-trip...\n");
+    int text_count = 0;
+    Process* text = parse_config_file("configs/test1.conf", &text_count);
+    assert(text != NULL);
+
+    char path[] = "/tmp/test_parser_logic_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    assert(write_binary_workload(path, text, text_count) == 0);
+
+    // Loaded through the usual entry point, recognized by content
+    int binary_count = 0;
+    ParseStats stats;
+    Process* binary = parse_config_file_with_stats(path, &binary_count, &stats);
+    assert(binary != NULL && stats.binary);
+    assert(binary_count == text_count);
+    assert(memcmp(binary, text, sizeof(Process) * text_count) == 0);
+    free(binary);
+
+    // And back to text
+    FILE* file = fopen(path, "w");
+    assert(file != NULL && write_config_text(file, text, text_count) == 0);
+    fclose(file);
+    binary = parse_config_file_with_stats(path, &binary_count, &stats);
+    assert(binary != NULL && !stats.binary && binary_count == text_count);
+    assert(memcmp(binary, text, sizeof(Process) * text_count) == 0);
+    free(binary);
+
+    // Unnamed processes are written with a placeholder name and otherwise round-trip
+    char saved_name[sizeof(text[1].name)];
+    memcpy(saved_name, text[1].name, sizeof(saved_name));
+    text[1].name[0] = '\0';
+    file = fopen(path, "w");
+    assert(file != NULL && write_config_text(file, text, text_count) == 0);
+    fclose(file);
+    binary = parse_config_file_with_stats(path, &binary_count, &stats);
+    assert(binary != NULL && binary_count == text_count);
+    assert(strcmp(binary[1].name, "P2") == 0);
+    assert(binary[1].arrival_time == text[1].arrival_time && binary[1].burst_time == text[1].burst_time);
+    assert(binary[1].priority == text[1].priority);
+    free(binary);
+    memcpy(text[1].name, saved_name, sizeof(saved_name));
+
+    // Damaged files are refused
+    assert(write_binary_workload(path, text, text_count) == 0);
+    file = fopen(path, "rb");
+    assert(file != NULL);
+    char image[4096];
+    size_t size = fread(image, 1, sizeof(image), file);
+    fclose(file);
+    BinaryWorkloadHeader header;
+    memcpy(&header, image, sizeof(header));
+
+    int count = 0;
+    assert(load_binary_workload(image, size, &count) != NULL);
+    free(load_binary_workload(image, size, &count));
+    assert(load_binary_workload(image, sizeof(header) - 1, &count) == NULL);
+    assert(load_binary_workload(image, header.names_offset, &count) == NULL);
+
+    BinaryWorkloadHeader bad = header;
+    bad.version = BINARY_WORKLOAD_VERSION + 1;
+    memcpy(image, &bad, sizeof(bad));
+    assert(load_binary_workload(image, size, &count) == NULL);
+
+    BinaryProcessRecord record;
+    memcpy(image, &header, sizeof(header));
+    memcpy(&record, image + header.records_offset, sizeof(record));
+    record.burst_time = 0;
+    memcpy(image + header.records_offset, &record, sizeof(record));
+    assert(load_binary_workload(image, size, &count) == NULL);
+
+    unlink(path);
+    free(text);
+    printf("  ✅ Binary and text workloads load the same processes.\n");
+}
+
+// Reads a whole file through a ConfigReader and checks it matches the full parse
+static void assert_reader_matches(const char* path, const Process* expected, int expected_count) {
+    ConfigReader* reader = config_reader_open(path);
+    assert(reader != NULL);
+    Process process;
+    int count = 0;
+    int status;
+    while ((status = config_reader_next(reader, &process)) == 1) {
+        assert(count < expected_count);
+        assert(memcmp(&process, &expected[count], sizeof(Process)) == 0);
+        count++;
+    }
+    assert(status == 0 && count == expected_count);
+    assert(config_reader_next(reader, &process) == 0);
+    config_reader_close(reader);
+}
+
+static void test_config_reader() {
+    printf("Asserting the process-by-process reader matches the full parse...\n");
+    int text_count = 0;
+    Process* text = parse_config_file("configs/test1.conf", &text_count);
+    assert(text != NULL);
+    assert_reader_matches("configs/test1.conf", text, text_count);
+
+    char path[] = "/tmp/test_parser_reader_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    assert(write_binary_workload(path, text, text_count) == 0);
+    assert_reader_matches(path, text, text_count);
+
+    // Errors surface on the process that holds them
+    FILE* file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("process A {\narrival_time = 0\nburst_time = 2\n}\nprocess B {\nburst_time = 1\n}\n", file);
+    fclose(file);
+    ConfigReader* reader = config_reader_open(path);
+    assert(reader != NULL);
+    Process process;
+    assert(config_reader_next(reader, &process) == 1);
+    check_process(&process, "A", 0, 2, 0);
+    assert(config_reader_next(reader, &process) == -1);
+    config_reader_close(reader);
+
+    unlink(path);
+    free(text);
+    printf("  ✅ Text and binary configs read one process at a time.\n");
+}
+
 int main() {
     printf("--- Running Automated Parser Logic Test ---\n");
     const char* config_filepath = "configs/test1.conf";
@@ -43,6 +287,18 @@ int main() {
     // 4. Cleanup
     free(processes);
 
+    // 5. The in-place parser accepts exactly what the line reader accepts
+    test_parse_paths_agree();
+
+    // 6. Splitting the parse across threads changes nothing
+    test_parallel_parse();
+
+    // 7. Binary workloads
+    test_binary_workload();
+
+    // 8. Reading one process at a time
+    test_config_reader();
+
     printf("\nTEST PASSED: Parser correctly processed 'test1.conf'.\n");
     return 0;
 }
@@ -1,7 +1,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
+#include <pthread.h>
 #include "../headers/engine/policy_interface.h"
+#include "../headers/policies/policies.h"
 
 void test_fifo_creation() {
     printf("Testing valid policy creation ('fifo'...).\n");
@@ -28,11 +31,76 @@ void test_invalid_policy_creation() {
     printf("  ✅ Policy creation correctly returned NULL for an invalid name.\n");
 }
 
+// Each thread creates and destroys every policy several times
+static void* create_policies_worker(void* arg) {
+    (void)arg;
+    const char* names[] = {"fifo", "rr", "mlfq", "srt"};
+    for (int round = 0; round < 50; round++) {
+        for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+            Policy* policy = policy_create(names[i], 2);
+            assert(policy != NULL);
+            policy_destroy(policy);
+        }
+    }
+    return NULL;
+}
+
+void test_concurrent_first_use() {
+    printf("Testing policy creation from several threads before any registration...\n");
+    // No explicit register_all_policies(): the first policy_create does it
+    pthread_t threads[8];
+    for (int i = 0; i < 8; i++) {
+        assert(pthread_create(&threads[i], NULL, create_policies_worker, NULL) == 0);
+    }
+    for (int i = 0; i < 8; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    printf("  ✅ Every thread created its policies.\n");
+}
+
+void test_repeated_registration() {
+    printf("Testing repeated and unbounded registration...\n");
+    int count = 0;
+    get_available_policies(&count);
+    assert(count > 0);
+
+    // Re-registering (e.g. on a TUI restart) must not duplicate or overflow
+    for (int i = 0; i < 20; i++) {
+        register_all_policies();
+    }
+    int after = 0;
+    const char** names = get_available_policies(&after);
+    assert(after == count);
+    for (int i = 0; i < after; i++) {
+        for (int j = i + 1; j < after; j++) {
+            assert(strcmp(names[i], names[j]) != 0);
+        }
+    }
+    printf("  ✅ %d policies, no duplicates.\n", after);
+
+    // There is no fixed cap on the number of policies
+    static PolicyVTable extra[32];
+    static char extra_names[32][16];
+    for (int i = 0; i < 32; i++) {
+        snprintf(extra_names[i], sizeof(extra_names[i]), "extra_%d", i);
+        extra[i].name = extra_names[i];
+        register_policy(&extra[i]);
+        register_policy(&extra[i]);
+    }
+    get_available_policies(&after);
+    assert(after == count + 32);
+    printf("  ✅ Registered %d policies in total.\n", after);
+}
+
 int main() {
     printf("--- Running Policy Interface Dispatcher Test ---\n\n");
+    test_concurrent_first_use();
+    printf("\n");
     test_fifo_creation();
     printf("\n");
     test_invalid_policy_creation();
+    printf("\n");
+    test_repeated_registration();
     printf("\nTEST PASSED: Policy dispatcher works as expected.\n");
     return 0;
 }
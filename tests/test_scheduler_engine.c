@@ -5,6 +5,10 @@
 #include <math.h> // For fabs
 
 #include "../headers/engine/scheduler_engine.h"
+#include "../headers/policies/policies.h"
+#include "../headers/engine/sweep.h"
+#include "../headers/output/results_writer.h"
+#include <unistd.h>
 
 // Define a small tolerance for float comparisons
 #define EPSILON 0.001f
@@ -44,9 +48,30 @@ void test_fifo_scheduler() {
     printf("  ✅ CPU Utilization: %.2f%% (Expected: 100.00%%)\n", results->cpu_utilization);
 
     // 5. Assert Gantt Chart (basic check: not empty)
-    assert(results->gantt_chart != NULL);
-    assert(results->gantt_event_count > 0);
+    assert(results->gantt_segments != NULL);
+    assert(results->gantt_segment_count > 0);
     printf("  ✅ Gantt chart data is present.\n");
+
+    // FIFO never switches mid-burst: one segment per process, expanding to one event per tick
+    assert(results->gantt_segment_count == 6);
+    int event_count = 0;
+    GanttEvent* events = expand_gantt_segments(results, &event_count);
+    assert(events != NULL);
+    assert(event_count == 25); // Sum of all bursts, CPU never idle
+    for (int i = 0; i < event_count; i++) {
+        assert(events[i].time == i);
+    }
+    assert(strcmp(events[0].process_name, "P1") == 0);
+    assert(strcmp(events[event_count - 1].process_name, "P6") == 0);
+    assert(events[event_count - 1].process_id == 5);
+    free(events);
+
+    // Ids index the config order, whatever order the engine left the processes in
+    for (int id = 0; id < results->process_count; id++) {
+        assert(results->process_by_id[id]->original_index == id);
+    }
+    printf("  ✅ Process id table resolves every id.\n");
+    printf("  ✅ Gantt segments expand to one event per tick.\n");
     
     // 6. Cleanup
     free_simulation_results(results);
@@ -76,8 +101,8 @@ void test_lifo_scheduler() {
     printf("  ✅ Average Turnaround Time: %.2f (Expected: 5.33)\n", results->average_turnaround_time);
     assert(fabs(results->average_waiting_time - 2.333333f) < EPSILON);
     printf("  ✅ Average Waiting Time: %.2f (Expected: 2.33)\n", results->average_waiting_time);
-    assert(results->gantt_chart != NULL);
-    assert(results->gantt_event_count > 0);
+    assert(results->gantt_segments != NULL);
+    assert(results->gantt_segment_count > 0);
     printf("  ✅ Gantt chart data is present.\n");
     
     free_simulation_results(results);
@@ -107,8 +132,8 @@ void test_sjf_scheduler() {
     printf("  ✅ Average Turnaround Time: %.2f (Expected: 5.33)\n", results->average_turnaround_time);
     assert(fabs(results->average_waiting_time - 2.000000f) < EPSILON);
     printf("  ✅ Average Waiting Time: %.2f (Expected: 2.00)\n", results->average_waiting_time);
-    assert(results->gantt_chart != NULL);
-    assert(results->gantt_event_count > 0);
+    assert(results->gantt_segments != NULL);
+    assert(results->gantt_segment_count > 0);
     printf("  ✅ Gantt chart data is present.\n");
     
     free_simulation_results(results);
@@ -138,8 +163,8 @@ void test_priority_scheduler() {
     printf("  ✅ Average Turnaround Time: %.2f (Expected: 7.00)\n", results->average_turnaround_time);
     assert(fabs(results->average_waiting_time - 3.000000f) < EPSILON);
     printf("  ✅ Average Waiting Time: %.2f (Expected: 3.00)\n", results->average_waiting_time);
-    assert(results->gantt_chart != NULL);
-    assert(results->gantt_event_count > 0);
+    assert(results->gantt_segments != NULL);
+    assert(results->gantt_segment_count > 0);
     printf("  ✅ Gantt chart data is present.\n");
     
     free_simulation_results(results);
@@ -148,13 +173,942 @@ void test_priority_scheduler() {
     printf("\nTEST PASSED: Scheduler Engine (Priority) test complete.\n\n\n");
 }
 
+// Runs the same parameters with both engines and checks the results are identical
+static void assert_runs_agree(const SimParameters* base) {
+    SimParameters params = *base;
+    params.engine_mode = SIM_ENGINE_EVENT;
+    SimulationResult* event_results = run_simulation(&params);
+    params.engine_mode = SIM_ENGINE_TICK;
+    SimulationResult* tick_results = run_simulation(&params);
+
+    assert(event_results != NULL && tick_results != NULL);
+    assert(event_results->process_count == tick_results->process_count);
+    for (int i = 0; i < event_results->process_count; i++) {
+        Process* e = &event_results->processes[i];
+        Process* t = &tick_results->processes[i];
+        assert(strcmp(e->name, t->name) == 0);
+        assert(e->start_time == t->start_time);
+        assert(e->finish_time == t->finish_time);
+        assert(e->waiting_time == t->waiting_time);
+        assert(e->response_time == t->response_time);
+    }
+    assert(event_results->gantt_segment_count == tick_results->gantt_segment_count);
+    for (int i = 0; i < event_results->gantt_segment_count; i++) {
+        assert(event_results->gantt_segments[i].start_time == tick_results->gantt_segments[i].start_time);
+        assert(event_results->gantt_segments[i].end_time == tick_results->gantt_segments[i].end_time);
+        assert(event_results->gantt_segments[i].process_id == tick_results->gantt_segments[i].process_id);
+    }
+    assert(event_results->cpu_utilization == tick_results->cpu_utilization);
+    for (int c = 0; c < event_results->cpu_count; c++) {
+        assert(event_results->cpu_lanes[c].segment_count == tick_results->cpu_lanes[c].segment_count);
+        assert(event_results->cpu_lanes[c].busy_time == tick_results->cpu_lanes[c].busy_time);
+        assert(event_results->cpu_lanes[c].steals == tick_results->cpu_lanes[c].steals);
+        assert(event_results->cpu_lanes[c].migration_time == tick_results->cpu_lanes[c].migration_time);
+    }
+    assert(event_results->migration_count == tick_results->migration_count);
+    assert(event_results->max_imbalance == tick_results->max_imbalance);
+    assert(event_results->imbalance_segment_count == tick_results->imbalance_segment_count);
+    for (int i = 0; i < event_results->imbalance_segment_count; i++) {
+        assert(event_results->imbalance_segments[i].end_time == tick_results->imbalance_segments[i].end_time);
+        assert(event_results->imbalance_segments[i].imbalance == tick_results->imbalance_segments[i].imbalance);
+    }
+
+    free_simulation_results(event_results);
+    free_simulation_results(tick_results);
+}
+
+static void assert_engines_agree(const char* config, const char* policy, int quantum, int cpu_count) {
+    SimParameters params = {
+        .config_filepath = config,
+        .policy_name = policy,
+        .quantum = quantum,
+        .cpu_count = cpu_count
+    };
+    assert_runs_agree(&params);
+}
+
+// Checks every burst tick runs exactly once, never on two CPUs at the same time
+static void assert_lanes_consistent(const SimulationResult* results) {
+    int end_time = results->cpu_lanes[0].segments[results->cpu_lanes[0].segment_count - 1].end_time;
+    int* runs = calloc(results->process_count, sizeof(int));
+    int* owner = malloc(sizeof(int) * results->process_count * end_time);
+    for (int i = 0; i < results->process_count * end_time; i++) owner[i] = -1;
+    long long busy = 0, burst = 0;
+    for (int c = 0; c < results->cpu_count; c++) {
+        CpuLane* lane = &results->cpu_lanes[c];
+        assert(lane->segments[lane->segment_count - 1].end_time == end_time);
+        for (int i = 0; i < lane->segment_count; i++) {
+            int id = lane->segments[i].process_id;
+            if (id < 0) continue;
+            for (int t = lane->segments[i].start_time; t < lane->segments[i].end_time; t++) {
+                assert(owner[id * end_time + t] == -1);
+                owner[id * end_time + t] = c;
+                runs[id]++;
+            }
+        }
+        busy += lane->busy_time;
+    }
+    for (int id = 0; id < results->process_count; id++) {
+        assert(runs[id] == results->process_by_id[id]->burst_time);
+        burst += results->process_by_id[id]->burst_time;
+    }
+    assert(busy == burst);
+    free(runs);
+    free(owner);
+}
+
+void test_tied_processes_run_fcfs() {
+    printf("--- Running Scheduler Engine Test (full ties with test_ties.conf) ---\n");
+
+    // Golden schedule: processes tied on the policy's key run in arrival order, then config order
+    const char* policies[] = {"sjf", "srt", "priority", "preemptive_priority"};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        for (int mode = 0; mode < 2; mode++) {
+            SimParameters params = {
+                .config_filepath = "configs/test_ties.conf",
+                .policy_name = policies[p],
+                .engine_mode = mode ? SIM_ENGINE_TICK : SIM_ENGINE_EVENT
+            };
+            SimulationResult* results = run_simulation(&params);
+            assert(results != NULL && results->process_count == 7);
+            assert(results->gantt_segment_count == 7);
+            for (int i = 0; i < 7; i++) {
+                const GanttSegment* segment = &results->gantt_segments[i];
+                assert(segment->process_id == i);
+                assert(segment->start_time == 2 * i && segment->end_time == 2 * i + 2);
+            }
+            free_simulation_results(results);
+        }
+        printf("  ✅ %s runs P1, P2, ..., P7.\n", policies[p]);
+    }
+
+    printf("\nTEST PASSED: Scheduler Engine (full ties) test complete.\n\n\n");
+}
+
+void test_event_engine_matches_tick_engine() {
+    printf("--- Running Scheduler Engine Test (event-driven vs tick reference) ---\n");
+
+    const char* configs[] = {"configs/test1.conf", "configs/test2.conf", "configs/mlfq_test.conf", "configs/test_priority.conf"};
+    const char* policies[] = {"fifo", "lifo", "sjf", "priority", "rr", "srt", "mlfq", "preemptive_priority"};
+    int quanta[] = {1, 3};
+
+    for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+            for (size_t q = 0; q < sizeof(quanta) / sizeof(quanta[0]); q++) {
+                assert_engines_agree(configs[c], policies[p], quanta[q], 1);
+            }
+        }
+        printf("  ✅ %s: all policies identical in both engines.\n", configs[c]);
+    }
+
+    printf("\nTEST PASSED: Event-driven engine matches the tick engine.\n\n\n");
+}
+
+void test_multi_cpu_global_queue() {
+    printf("--- Running Scheduler Engine Test (several CPUs, one ready queue) ---\n");
+
+    const char* policies[] = {"fifo", "lifo", "sjf", "priority", "rr", "srt", "mlfq", "preemptive_priority"};
+    int cpu_counts[] = {2, 3, 8};
+
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        for (size_t n = 0; n < sizeof(cpu_counts) / sizeof(cpu_counts[0]); n++) {
+            SimParameters params = {
+                .config_filepath = "configs/test2.conf",
+                .policy_name = policies[p],
+                .quantum = 2,
+                .cpu_count = cpu_counts[n]
+            };
+            SimulationResult* results = run_simulation(&params);
+            assert(results != NULL);
+            assert(results->cpu_count == cpu_counts[n]);
+            assert_lanes_consistent(results);
+            assert(results->migration_count == 0 && results->imbalance_segments == NULL);
+            free_simulation_results(results);
+
+            assert_engines_agree("configs/test2.conf", policies[p], 2, cpu_counts[n]);
+            assert_engines_agree("configs/mlfq_test.conf", policies[p], 1, cpu_counts[n]);
+        }
+    }
+    printf("  ✅ Lanes are consistent and both engines agree for 2, 3 and 8 CPUs.\n");
+
+    printf("\nTEST PASSED: Multi-CPU global queue.\n\n\n");
+}
+
+void test_per_cpu_queues_with_stealing() {
+    printf("--- Running Scheduler Engine Test (per-CPU run queues, work stealing) ---\n");
+
+    const char* configs[] = {"configs/test2.conf", "configs/mlfq_test.conf"};
+    const char* policies[] = {"fifo", "sjf", "rr", "srt", "mlfq", "preemptive_priority"};
+    int intervals[] = {0, 1, 3};
+    int costs[] = {0, 2};
+
+    for (size_t f = 0; f < sizeof(configs) / sizeof(configs[0]); f++) {
+        for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+            for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+                for (size_t m = 0; m < sizeof(costs) / sizeof(costs[0]); m++) {
+                    SimParameters params = {
+                        .config_filepath = configs[f],
+                        .policy_name = policies[p],
+                        .quantum = 2,
+                        .cpu_count = 3,
+                        .queue_model = SIM_QUEUE_PER_CPU,
+                        .balance_interval = intervals[i],
+                        .migration_cost = costs[m]
+                    };
+                    SimulationResult* results = run_simulation(&params);
+                    assert(results != NULL);
+                    assert_lanes_consistent(results);
+
+                    // Steals add up, each one paying the migration cost; no balancing means no steals
+                    int steals = 0;
+                    long long migration_time = 0;
+                    for (int c = 0; c < results->cpu_count; c++) {
+                        steals += results->cpu_lanes[c].steals;
+                        migration_time += results->cpu_lanes[c].migration_time;
+                    }
+                    assert(steals == results->migration_count);
+                    assert(migration_time == (long long)steals * costs[m]);
+                    if (intervals[i] == 0) assert(results->migration_count == 0);
+                    assert(results->imbalance_segment_count > 0);
+                    free_simulation_results(results);
+
+                    assert_runs_agree(&params);
+                }
+            }
+        }
+    }
+    printf("  ✅ Steals, migration costs and imbalance agree in both engines.\n");
+
+    printf("\nTEST PASSED: Per-CPU run queues.\n\n\n");
+}
+
+void test_workload_reuse() {
+    printf("--- Running Scheduler Engine Test (one workload, many runs) ---\n");
+
+    Workload* workload = workload_load("configs/test2.conf");
+    assert(workload != NULL);
+    assert(workload->processes[0].original_index == 0);
+
+    const char* policies[] = {"fifo", "rr", "mlfq", "fifo"};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        SimParameters params = {
+            .config_filepath = "configs/test2.conf",
+            .policy_name = policies[p],
+            .quantum = 2
+        };
+        SimulationResult* reused = run_simulation_on(workload, &params);
+        SimulationResult* fresh = run_simulation(&params);
+        assert(reused != NULL && fresh != NULL);
+        assert(reused->process_count == fresh->process_count);
+        for (int i = 0; i < reused->process_count; i++) {
+            assert(strcmp(reused->processes[i].name, fresh->processes[i].name) == 0);
+            assert(reused->processes[i].finish_time == fresh->processes[i].finish_time);
+            assert(reused->processes[i].waiting_time == fresh->processes[i].waiting_time);
+        }
+        assert(reused->gantt_segment_count == fresh->gantt_segment_count);
+        free_simulation_results(reused);
+        free_simulation_results(fresh);
+    }
+    printf("  ✅ Runs on a shared workload match fresh parses.\n");
+
+    // The workload must come out of every run untouched
+    for (int i = 0; i < workload->process_count; i++) {
+        assert(workload->processes[i].original_index == i);
+        assert(workload->processes[i].finish_time == 0);
+    }
+    printf("  ✅ Workload left unmodified.\n");
+
+    workload_free(workload);
+    printf("\nTEST PASSED: Workload reuse.\n\n\n");
+}
+
+void test_parallel_sweep() {
+    printf("--- Running Scheduler Engine Test (parallel sweep) ---\n");
+
+    const char* configs[] = {"configs/test1.conf", "configs/test2.conf"};
+    const char* policies[] = {"fifo", "rr", "mlfq"};
+    int quanta[] = {1, 3};
+    SweepPlan plan = {
+        .configs = configs, .config_count = 2,
+        .policies = policies, .policy_count = 3,
+        .quanta = quanta, .quantum_count = 2,
+        .jobs = 4
+    };
+
+    int row_count = 0;
+    SweepRow* rows = run_sweep(&plan, &row_count);
+    assert(rows != NULL);
+    // fifo runs once per config, rr and mlfq once per quantum
+    assert(row_count == 2 * (1 + 2 + 2));
+
+    for (int r = 0; r < row_count; r++) {
+        assert(rows[r].ok);
+        assert(policy_takes_quantum(rows[r].policy_name) == (rows[r].quantum != 0));
+        SimParameters params = {
+            .config_filepath = rows[r].config_filepath,
+            .policy_name = rows[r].policy_name,
+            .quantum = rows[r].quantum
+        };
+        SimulationResult* results = run_simulation(&params);
+        assert(results != NULL);
+        assert(fabs(rows[r].average_waiting_time - results->average_waiting_time) < 1e-9);
+        assert(fabs(rows[r].average_turnaround_time - results->average_turnaround_time) < 1e-9);
+        assert(fabs(rows[r].cpu_utilization - results->cpu_utilization) < 1e-9);
+        int makespan = 0;
+        for (int i = 0; i < results->process_count; i++) {
+            if (results->processes[i].finish_time > makespan) makespan = results->processes[i].finish_time;
+        }
+        assert(rows[r].makespan == makespan);
+        free_simulation_results(results);
+    }
+    // Rows come back in plan order no matter which worker ran them
+    assert(strcmp(rows[0].config_filepath, "configs/test1.conf") == 0);
+    assert(strcmp(rows[0].policy_name, "fifo") == 0);
+    assert(strcmp(rows[row_count - 1].config_filepath, "configs/test2.conf") == 0);
+    assert(strcmp(rows[row_count - 1].policy_name, "mlfq") == 0 && rows[row_count - 1].quantum == 3);
+    printf("  ✅ Every sweep row matches a sequential run.\n");
+
+    free(rows);
+    printf("\nTEST PASSED: Parallel sweep.\n\n\n");
+}
+
+void test_configurable_mlfq() {
+    printf("--- Running Scheduler Engine Test (configurable MLFQ) ---\n");
+
+    // Spelling out the defaults must give the default schedule
+    int default_quanta[20];
+    for (int i = 0; i < 20; i++) default_quanta[i] = 2 * (i / 5 + 1);    // Top level first
+    MlfqParameters spelled_out = {
+        .level_count = 20, .quanta = default_quanta, .quanta_count = 20,
+        .allotment_ratio = 5, .aging_threshold = 10
+    };
+    const char* configs[] = {"configs/test2.conf", "configs/mlfq_test.conf"};
+    for (size_t f = 0; f < sizeof(configs) / sizeof(configs[0]); f++) {
+        SimParameters params = { .config_filepath = configs[f], .policy_name = "mlfq", .quantum = 2 };
+        SimulationResult* defaults = run_simulation(&params);
+        params.mlfq = &spelled_out;
+        SimulationResult* explicit = run_simulation(&params);
+        assert(defaults != NULL && explicit != NULL);
+        for (int i = 0; i < defaults->process_count; i++) {
+            assert(defaults->processes[i].finish_time == explicit->processes[i].finish_time);
+            assert(defaults->processes[i].waiting_time == explicit->processes[i].waiting_time);
+        }
+        assert(defaults->gantt_segment_count == explicit->gantt_segment_count);
+        free_simulation_results(defaults);
+        free_simulation_results(explicit);
+    }
+    printf("  ✅ Explicit default tables match the built-in defaults.\n");
+
+    // Custom shapes: few levels, many levels (past one bitmap word), no aging, boosts
+    int quanta[] = {2, 4, 8};
+    int allotments[] = {4, 16};
+    MlfqParameters shapes[] = {
+        { .level_count = 3, .quanta = quanta, .quanta_count = 3 },
+        { .level_count = 3, .quanta = quanta, .quanta_count = 3, .allotments = allotments, .allotment_count = 2, .boost_period = 25 },
+        { .level_count = 130, .aging_threshold = 3 },
+        { .level_count = 1 },
+        { .level_count = 8, .aging_threshold = -1, .boost_period = 7 },
+    };
+    for (size_t m = 0; m < sizeof(shapes) / sizeof(shapes[0]); m++) {
+        for (size_t f = 0; f < sizeof(configs) / sizeof(configs[0]); f++) {
+            for (int cpus = 1; cpus <= 2; cpus++) {
+                SimParameters params = {
+                    .config_filepath = configs[f], .policy_name = "mlfq", .quantum = 1,
+                    .cpu_count = cpus, .queue_model = (cpus > 1) ? SIM_QUEUE_PER_CPU : SIM_QUEUE_GLOBAL,
+                    .balance_interval = 2, .mlfq = &shapes[m]
+                };
+                SimulationResult* results = run_simulation(&params);
+                assert(results != NULL);
+                assert_lanes_consistent(results);
+                for (int i = 0; i < results->process_count; i++) {
+                    assert(results->processes[i].finish_time > 0);
+                    assert(results->processes[i].current_queue_level < shapes[m].level_count);
+                }
+                free_simulation_results(results);
+                assert_runs_agree(&params);
+            }
+        }
+    }
+    printf("  ✅ Custom level counts, tables, aging and boosts run the same in both engines.\n");
+
+    // Invalid tables are rejected at policy creation
+    int bad_quanta[] = {2, 0};
+    MlfqParameters invalid[] = {
+        { .quanta = bad_quanta, .quanta_count = 2 },
+        { .level_count = MLFQ_MAX_LEVELS + 1 },
+        { .boost_period = -1 },
+    };
+    for (size_t m = 0; m < sizeof(invalid) / sizeof(invalid[0]); m++) {
+        SimParameters params = { .config_filepath = "configs/test1.conf", .policy_name = "mlfq", .quantum = 2, .mlfq = &invalid[m] };
+        assert(run_simulation(&params) == NULL);
+    }
+    printf("  ✅ Invalid MLFQ parameters are rejected.\n");
+
+    printf("\nTEST PASSED: Configurable MLFQ.\n\n\n");
+}
+
+// Sink recording the final metrics of each streamed process by id
+typedef struct {
+    int finish_time[16];
+    int waiting_time[16];
+    int response_time[16];
+    int count;
+} StreamedMetrics;
+
+static void record_streamed(void* context, const Process* process) {
+    StreamedMetrics* metrics = (StreamedMetrics*)context;
+    assert(process->state == TERMINATED);
+    metrics->finish_time[process->original_index] = process->finish_time;
+    metrics->waiting_time[process->original_index] = process->waiting_time;
+    metrics->response_time[process->original_index] = process->response_time;
+    metrics->count++;
+}
+
+// Source handing out `remaining` one-tick processes, one arriving per tick
+typedef struct {
+    int next_id;
+    int remaining;
+} SyntheticStream;
+
+static int next_synthetic(void* context, Process* process) {
+    SyntheticStream* stream = (SyntheticStream*)context;
+    if (stream->remaining == 0) return 0;
+    stream->remaining--;
+    snprintf(process->name, sizeof(process->name), "S%d", stream->next_id);
+    process->arrival_time = stream->next_id;
+    process->burst_time = 1;
+    process->original_index = stream->next_id++;
+    return 1;
+}
+
+void test_streaming_source() {
+    printf("--- Running Scheduler Engine Test (streaming process source) ---\n");
+
+    // Streaming a sorted config gives the same schedule as loading it
+    const char* configs[] = {"configs/test1.conf", "configs/mlfq_test.conf"};
+    const char* policies[] = {"fifo", "sjf", "rr", "mlfq", "srt"};
+    for (size_t f = 0; f < sizeof(configs) / sizeof(configs[0]); f++) {
+        for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+            for (int cpus = 1; cpus <= 2; cpus++) {
+                SimParameters params = { .config_filepath = configs[f], .policy_name = policies[p], .quantum = 2, .cpu_count = cpus };
+                SimulationResult* loaded = run_simulation(&params);
+                StreamedMetrics metrics;
+                memset(&metrics, 0, sizeof(metrics));
+                ResultsSink sink = { .on_process = record_streamed, .context = &metrics };
+                params.sink = &sink;
+                SimulationResult* streamed = run_simulation_streamed(&params);
+                assert(loaded != NULL && streamed != NULL);
+
+                assert(streamed->processes == NULL && streamed->process_by_id == NULL);
+                assert(streamed->process_count == loaded->process_count);
+                assert(metrics.count == loaded->process_count);
+                assert(streamed->peak_resident_processes > 0 && streamed->peak_resident_processes <= loaded->process_count);
+                for (int id = 0; id < loaded->process_count; id++) {
+                    assert(metrics.finish_time[id] == loaded->process_by_id[id]->finish_time);
+                    assert(metrics.waiting_time[id] == loaded->process_by_id[id]->waiting_time);
+                    assert(metrics.response_time[id] == loaded->process_by_id[id]->response_time);
+                }
+                assert(fabs(streamed->average_waiting_time - loaded->average_waiting_time) < EPSILON);
+                assert(fabs(streamed->average_turnaround_time - loaded->average_turnaround_time) < EPSILON);
+                assert(streamed->cpu_utilization == loaded->cpu_utilization);
+                for (int c = 0; c < cpus; c++) {
+                    assert(streamed->cpu_lanes[c].segment_count == loaded->cpu_lanes[c].segment_count);
+                    for (int i = 0; i < loaded->cpu_lanes[c].segment_count; i++) {
+                        assert(streamed->cpu_lanes[c].segments[i].end_time == loaded->cpu_lanes[c].segments[i].end_time);
+                        assert(streamed->cpu_lanes[c].segments[i].process_id == loaded->cpu_lanes[c].segments[i].process_id);
+                    }
+                }
+                free_simulation_results(loaded);
+                free_simulation_results(streamed);
+            }
+        }
+    }
+    printf("  ✅ Streamed configs schedule exactly like loaded ones.\n");
+
+    // A long trace only keeps the processes in flight
+    SyntheticStream stream = { .next_id = 0, .remaining = 100000 };
+    ProcessSource source = { .next = next_synthetic, .context = &stream };
+    SimParameters params = { .policy_name = "fifo" };
+    SimulationResult* results = run_simulation_from_source(&source, &params);
+    assert(results != NULL);
+    assert(results->process_count == 100000);
+    assert(results->peak_resident_processes == 1);
+    assert(fabs(results->average_waiting_time) < EPSILON);
+    assert(fabs(results->cpu_utilization - 100.0f) < EPSILON);
+    free_simulation_results(results);
+    printf("  ✅ 100000 streamed processes run with one resident at a time.\n");
+
+    // Configs out of arrival order are rejected (test2.conf goes back from 7 to 6)
+    SimParameters unsorted = { .config_filepath = "configs/test2.conf", .policy_name = "fifo" };
+    assert(run_simulation_streamed(&unsorted) == NULL);
+    printf("  ✅ Streams out of arrival order are rejected.\n");
+
+    printf("\nTEST PASSED: Streaming process source.\n\n\n");
+}
+
+
+// Sink collecting every closed Gantt segment, per CPU
+typedef struct {
+    GanttSegment segments[2][256];
+    int counts[2];
+    int processes;
+} CollectedResults;
+
+static void collect_process(void* context, const Process* process) {
+    ((CollectedResults*)context)->processes++;
+}
+
+static void collect_segment(void* context, int cpu, const GanttSegment* segment) {
+    CollectedResults* collected = (CollectedResults*)context;
+    assert(cpu >= 0 && cpu < 2 && collected->counts[cpu] < 256);
+    collected->segments[cpu][collected->counts[cpu]++] = *segment;
+}
+
+void test_results_sink() {
+    printf("--- Running Scheduler Engine Test (results sink) ---\n");
+
+    // The sink receives exactly the segments the results would have kept
+    const char* policies[] = {"fifo", "rr", "mlfq"};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        for (int cpus = 1; cpus <= 2; cpus++) {
+            SimParameters params = { .config_filepath = "configs/test2.conf", .policy_name = policies[p], .quantum = 2, .cpu_count = cpus };
+            SimulationResult* kept = run_simulation(&params);
+            CollectedResults collected;
+            memset(&collected, 0, sizeof(collected));
+            ResultsSink sink = { .on_process = collect_process, .on_segment = collect_segment, .context = &collected };
+            params.sink = &sink;
+            SimulationResult* sunk = run_simulation(&params);
+            assert(kept != NULL && sunk != NULL);
+
+            assert(collected.processes == kept->process_count);
+            assert(sunk->gantt_segments == NULL && sunk->gantt_segment_count == 0);
+            for (int c = 0; c < cpus; c++) {
+                assert(sunk->cpu_lanes[c].segment_count == 0);
+                assert(sunk->cpu_lanes[c].busy_time == kept->cpu_lanes[c].busy_time);
+                assert(collected.counts[c] == kept->cpu_lanes[c].segment_count);
+                assert(memcmp(collected.segments[c], kept->cpu_lanes[c].segments, sizeof(GanttSegment) * collected.counts[c]) == 0);
+            }
+            assert(sunk->average_waiting_time == kept->average_waiting_time);
+            assert(sunk->cpu_utilization == kept->cpu_utilization);
+            free_simulation_results(kept);
+            free_simulation_results(sunk);
+        }
+    }
+    printf("  ✅ Segments are handed over as they close and not kept.\n");
+
+    // File writers: one row or record per process and per segment
+    SimParameters params = { .config_filepath = "configs/test1.conf", .policy_name = "rr", .quantum = 2 };
+    SimulationResult* reference = run_simulation(&params);
+    assert(reference != NULL);
+
+    char path[] = "/tmp/test_results_sink_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+
+    ResultsSink* sink = results_writer_open(path, RESULTS_FORMAT_CSV);
+    assert(sink != NULL);
+    params.sink = sink;
+    SimulationResult* results = run_simulation_streamed(&params);
+    assert(results != NULL);
+    assert(results_writer_close(sink) == 0);
+    free_simulation_results(results);
+
+    FILE* file = fopen(path, "r");
+    assert(file != NULL);
+    char line[256];
+    int process_rows = 0, segment_rows = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, "process,", 8) == 0) {
+            int id, finish;
+            char name[32];
+            assert(sscanf(line, "process,%d,%31[^,],%*d,%*d,%*d,%*d,%d", &id, name, &finish) == 3);
+            assert(strcmp(name, reference->process_by_id[id]->name) == 0);
+            assert(finish == reference->process_by_id[id]->finish_time);
+            process_rows++;
+        } else if (strncmp(line, "segment,", 8) == 0) {
+            segment_rows++;
+        } else {
+            assert(line[0] == '#');
+        }
+    }
+    fclose(file);
+    assert(process_rows == reference->process_count);
+    assert(segment_rows == reference->gantt_segment_count);
+
+    sink = results_writer_open(path, RESULTS_FORMAT_BINARY);
+    assert(sink != NULL);
+    params.sink = sink;
+    results = run_simulation_streamed(&params);
+    assert(results != NULL);
+    assert(results_writer_close(sink) == 0);
+    free_simulation_results(results);
+
+    file = fopen(path, "rb");
+    assert(file != NULL);
+    ResultsBinaryHeader header;
+    assert(fread(&header, sizeof(header), 1, file) == 1);
+    assert(memcmp(header.magic, RESULTS_BINARY_MAGIC, RESULTS_BINARY_MAGIC_SIZE) == 0);
+    assert(header.version == RESULTS_BINARY_VERSION && header.byte_order == RESULTS_BINARY_BYTE_ORDER);
+    process_rows = segment_rows = 0;
+    uint32_t kind;
+    while (fread(&kind, sizeof(kind), 1, file) == 1) {
+        if (kind == RESULTS_RECORD_PROCESS) {
+            ResultsProcessRecord record;
+            record.kind = kind;
+            assert(fread((char*)&record + sizeof(kind), sizeof(record) - sizeof(kind), 1, file) == 1);
+            const Process* expected = reference->process_by_id[record.process_id];
+            assert(strcmp(record.name, expected->name) == 0);
+            assert(record.waiting_time == expected->waiting_time && record.response_time == expected->response_time);
+            process_rows++;
+        } else {
+            assert(kind == RESULTS_RECORD_SEGMENT);
+            ResultsSegmentRecord record;
+            record.kind = kind;
+            assert(fread((char*)&record + sizeof(kind), sizeof(record) - sizeof(kind), 1, file) == 1);
+            assert(record.end_time == reference->gantt_segments[segment_rows].end_time);
+            assert(record.process_id == reference->gantt_segments[segment_rows].process_id);
+            segment_rows++;
+        }
+    }
+    fclose(file);
+    assert(process_rows == reference->process_count);
+    assert(segment_rows == reference->gantt_segment_count);
+
+    unlink(path);
+    free_simulation_results(reference);
+    printf("  ✅ CSV and binary results files hold every process and segment.\n");
+
+    printf("\nTEST PASSED: Results sink.\n\n\n");
+}
+
+
+void test_metric_reduction() {
+    printf("--- Running Scheduler Engine Test (metrics reduction) ---\n");
+
+    // Column kernel, single values and merges all agree with a direct two-pass computation
+    size_t count = (size_t)3 << 20;
+    int* column = (int*)malloc(count * sizeof(int));
+    assert(column != NULL);
+    long long expected_sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        column[i] = 1000000000 + (int)((i * 2654435761u) % 1000);
+        expected_sum += column[i];
+    }
+    double expected_mean = (double)expected_sum / count;
+    double expected_m2 = 0;
+    for (size_t i = 0; i < count; i++) expected_m2 += (column[i] - expected_mean) * (column[i] - expected_mean);
+
+    MetricAccumulator serial, threaded, merged, single;
+    metric_init(&serial);
+    metric_init(&threaded);
+    metric_init(&merged);
+    metric_init(&single);
+    metric_add_column(&serial, column, count, 1);
+    metric_add_column(&threaded, column, count, 4);
+    MetricAccumulator half;
+    metric_init(&half);
+    metric_add_column(&merged, column, count / 3, 1);
+    metric_add_column(&half, column + count / 3, count - count / 3, 1);
+    metric_merge(&merged, &half);
+    for (size_t i = 0; i < count; i++) metric_add(&single, column[i]);
+
+    MetricAccumulator* all[] = { &serial, &threaded, &merged, &single };
+    for (int a = 0; a < 4; a++) {
+        MetricSummary summary = metric_summarize(all[a]);
+        assert(summary.count == (long long)count);
+        assert(summary.total == expected_sum);   // exact, far beyond float precision
+        assert(summary.min == 1000000000 && summary.max == 1000000999);
+        assert(fabs(summary.mean - expected_mean) < 1e-6);
+        assert(fabs(summary.variance - expected_m2 / count) < 1e-3 * (expected_m2 / count));
+    }
+    free(column);
+    printf("  ✅ Serial, threaded, merged and one-by-one reductions agree.\n");
+
+    // Engine results carry the summaries, the same for loaded and streamed runs
+    SimParameters params = { .config_filepath = "configs/test1.conf", .policy_name = "rr", .quantum = 2 };
+    SimulationResult* loaded = run_simulation(&params);
+    SimulationResult* streamed = run_simulation_streamed(&params);
+    assert(loaded != NULL && streamed != NULL);
+    long long waiting = 0, response = 0;
+    int max_turnaround = 0;
+    for (int i = 0; i < loaded->process_count; i++) {
+        waiting += loaded->processes[i].waiting_time;
+        response += loaded->processes[i].response_time;
+        if (loaded->processes[i].turnaround_time > max_turnaround) max_turnaround = loaded->processes[i].turnaround_time;
+    }
+    assert(loaded->waiting_summary.count == loaded->process_count);
+    assert(loaded->waiting_summary.total == waiting);
+    assert(loaded->response_summary.total == response);
+    assert(loaded->turnaround_summary.max == max_turnaround);
+    assert(fabs(loaded->average_response_time - (float)response / loaded->process_count) < EPSILON);
+    assert(streamed->waiting_summary.total == loaded->waiting_summary.total);
+    assert(streamed->response_summary.min == loaded->response_summary.min);
+    assert(fabs(streamed->turnaround_summary.variance - loaded->turnaround_summary.variance) < 1e-9);
+    free_simulation_results(loaded);
+    free_simulation_results(streamed);
+    printf("  ✅ Results report exact totals, extremes and variances.\n");
+}
+
+static int compare_ints(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+void test_latency_percentiles() {
+    printf("--- Running Scheduler Engine Test (latency percentiles) ---\n");
+
+    // Small values are exact
+    LatencyHistogram small;
+    latency_histogram_init(&small);
+    for (int v = 1; v <= 100; v++) latency_histogram_record(&small, v);
+    LatencyPercentiles exact = latency_histogram_percentiles(&small);
+    assert(exact.p50 == 50 && exact.p90 == 90 && exact.p99 == 99 && exact.p999 == 100 && exact.max == 100);
+    printf("  ✅ Values below the first log bucket are reported exactly.\n");
+
+    // Larger values stay within the bucket precision, and halves merge into the whole
+    int count = 200000;
+    int* values = (int*)malloc(count * sizeof(int));
+    assert(values != NULL);
+    LatencyHistogram whole, first, second;
+    latency_histogram_init(&whole);
+    latency_histogram_init(&first);
+    latency_histogram_init(&second);
+    unsigned seed = 12345;
+    for (int i = 0; i < count; i++) {
+        seed = seed * 1103515245u + 12345u;
+        values[i] = (int)((seed >> 8) % 5000000);
+        latency_histogram_record(&whole, values[i]);
+        latency_histogram_record((i % 2) ? &first : &second, values[i]);
+    }
+    latency_histogram_merge(&first, &second);
+    assert(memcmp(&first, &whole, sizeof(LatencyHistogram)) == 0);
+
+    qsort(values, count, sizeof(int), compare_ints);
+    // Percentiles in tenths, so the nearest rank is exact integer math
+    const int permille[] = {500, 900, 990, 999, 1000};
+    for (size_t i = 0; i < sizeof(permille) / sizeof(permille[0]); i++) {
+        int rank = (int)(((long long)permille[i] * count + 999) / 1000);
+        int expected = values[rank - 1];
+        int reported = latency_histogram_percentile(&whole, permille[i] / 10.0);
+        assert(reported >= expected);
+        assert(reported - expected <= expected / 64 + 1);
+    }
+    assert(whole.max == values[count - 1]);
+    free(values);
+    printf("  ✅ Percentiles stay within 1/64 of the exact values; merged halves equal the whole.\n");
+
+    // The engine records every terminated process, for loaded and streamed runs alike
+    SimParameters params = { .config_filepath = "configs/mlfq_test.conf", .policy_name = "mlfq", .quantum = 2 };
+    SimulationResult* loaded = run_simulation(&params);
+    SimulationResult* streamed = run_simulation_streamed(&params);
+    assert(loaded != NULL && streamed != NULL);
+    assert(loaded->waiting_histogram.total_count == loaded->process_count);
+    assert(loaded->response_histogram.max == loaded->response_summary.max);
+    assert(loaded->turnaround_histogram.max == loaded->turnaround_summary.max);
+    assert(memcmp(&loaded->waiting_histogram, &streamed->waiting_histogram, sizeof(LatencyHistogram)) == 0);
+    free_simulation_results(loaded);
+    free_simulation_results(streamed);
+    printf("  ✅ Results carry waiting, response and turnaround histograms.\n");
+}
+
+void test_telemetry_recorder() {
+    printf("--- Running Scheduler Engine Test (telemetry recorder) ---\n");
+
+    // Off by default
+    SimParameters params = { .config_filepath = "configs/test2.conf", .policy_name = "rr", .quantum = 2 };
+    SimulationResult* plain = run_simulation(&params);
+    assert(plain != NULL && plain->telemetry == NULL);
+    free_simulation_results(plain);
+
+    // The event engine samples its skipped quiet ticks exactly like the tick engine
+    const char* policies[] = {"fifo", "rr", "srt", "mlfq"};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        for (int stride = 1; stride <= 3; stride += 2) {
+            params.policy_name = policies[p];
+            params.cpu_count = 2;
+            params.telemetry_stride = stride;
+            params.engine_mode = SIM_ENGINE_EVENT;
+            SimulationResult* event = run_simulation(&params);
+            params.engine_mode = SIM_ENGINE_TICK;
+            SimulationResult* tick = run_simulation(&params);
+            assert(event != NULL && tick != NULL && event->telemetry && tick->telemetry);
+
+            const TelemetrySeries* a = event->telemetry;
+            const TelemetrySeries* b = tick->telemetry;
+            assert(a->sample_count == b->sample_count && a->sample_count > 0);
+            for (int i = 0; i < a->sample_count; i++) {
+                assert(a->time[i] == i * stride);
+                assert(a->time[i] == b->time[i]);
+                assert(a->ready_length[i] == b->ready_length[i]);
+                assert(a->arrived[i] == b->arrived[i]);
+                assert(a->in_system[i] == b->in_system[i]);
+                assert(memcmp(a->cpu_busy + i * 2, b->cpu_busy + i * 2, 2) == 0);
+                // One shared queue and no migrations: every process in the system waits or runs
+                assert(a->in_system[i] == a->ready_length[i] + telemetry_busy_cpus(a, i));
+            }
+            free_simulation_results(event);
+            free_simulation_results(tick);
+        }
+    }
+    printf("  ✅ Event and tick engines record identical series.\n");
+
+    // Streamed runs count their arrivals too
+    params.config_filepath = "configs/test1.conf";
+    params.policy_name = "fifo";
+    params.cpu_count = 1;
+    params.engine_mode = SIM_ENGINE_EVENT;
+    params.telemetry_stride = 1;
+    SimulationResult* streamed = run_simulation_streamed(&params);
+    assert(streamed != NULL && streamed->telemetry != NULL);
+    const TelemetrySeries* series = streamed->telemetry;
+    assert(series->arrived[series->sample_count - 1] == streamed->process_count);
+    free_simulation_results(streamed);
+    printf("  ✅ Streamed runs record telemetry.\n");
+}
+
+// Reads a whole stream back from its start into a NUL-terminated buffer
+static char* read_stream(FILE* stream) {
+    long size = ftell(stream);
+    char* text = (char*)malloc(size + 1);
+    assert(text != NULL);
+    rewind(stream);
+    assert(fread(text, 1, size, stream) == (size_t)size);
+    text[size] = '\0';
+    return text;
+}
+
+void test_event_logger() {
+    printf("--- Running Scheduler Engine Test (event logger) ---\n");
+
+    // A binary log decodes to exactly what a text logger prints, even through a tiny ring
+    SimParameters params = { .config_filepath = "configs/test2.conf", .policy_name = "rr", .quantum = 2,
+                             .cpu_count = 2, .queue_model = SIM_QUEUE_PER_CPU, .balance_interval = 1 };
+    FILE* text = tmpfile();
+    FILE* binary = tmpfile();
+    FILE* decoded = tmpfile();
+    assert(text && binary && decoded);
+
+    Logger* text_logger = logger_open(text, LOG_FORMAT_TEXT, 4);
+    params.logger = text_logger;
+    SimulationResult* results = run_simulation(&params);
+    assert(results != NULL && results->migration_count > 0);
+    free_simulation_results(results);
+    assert(logger_close(text_logger) == 0);
+
+    Logger* binary_logger = logger_open(binary, LOG_FORMAT_BINARY, 0);
+    params.logger = binary_logger;
+    results = run_simulation(&params);
+    free_simulation_results(results);
+    assert(logger_close(binary_logger) == 0);
+    rewind(binary);
+    long long records = log_decode_file(binary, decoded);
+
+    char* expected = read_stream(text);
+    char* actual = read_stream(decoded);
+    assert(strcmp(expected, actual) == 0);
+    assert(strstr(expected, "Time 0: Process P1 arrived.\n") != NULL);
+    assert(strstr(expected, "starts running on CPU") != NULL && strstr(expected, " steals process ") != NULL);
+    long long lines = 0;
+    for (const char* c = expected; *c; c++) lines += (*c == '\n');
+    assert(records == lines && records > 0);
+    free(expected);
+    free(actual);
+    printf("  ✅ Decoded binary logs match text logs (%lld events).\n", records);
+
+    // Level and category filters drop events before they reach the ring
+    FILE* filtered = tmpfile();
+    Logger* filtered_logger = logger_open(filtered, LOG_FORMAT_TEXT, 0);
+    unsigned categories = 0;
+    LogLevel level;
+    assert(log_categories_parse("arrival,termination", &categories));
+    assert(!log_categories_parse("arrival,bogus", &categories) && !log_level_parse("loud", &level));
+    assert(log_level_parse("info", &level) && level == LOG_LEVEL_INFO);
+    logger_set_categories(filtered_logger, categories);
+    logger_set_level(filtered_logger, level);
+    params.logger = filtered_logger;
+    params.queue_model = SIM_QUEUE_GLOBAL;
+    results = run_simulation(&params);
+    int process_count = results->process_count;
+    free_simulation_results(results);
+    assert(logger_close(filtered_logger) == 0);
+    char* kept = read_stream(filtered);
+    int arrivals = 0, finishes = 0;
+    for (char* line = strtok(kept, "\n"); line; line = strtok(NULL, "\n")) {
+        if (strstr(line, " arrived.")) arrivals++;
+        else if (strstr(line, " finished.")) finishes++;
+        else assert(0 && "filtered event was logged");
+    }
+    assert(arrivals == process_count && finishes == process_count);
+    free(kept);
+    printf("  ✅ Level and category filters apply.\n");
+
+    fclose(text);
+    fclose(binary);
+    fclose(decoded);
+    fclose(filtered);
+}
+
+void test_engine_profile() {
+    printf("--- Running Scheduler Engine Test (engine profile) ---\n");
+
+    // Every simulated tick is accounted for, stepped or skipped, and runs accumulate
+    EngineProfile profile = { 0 };
+    SimParameters params = { .config_filepath = "configs/test2.conf", .policy_name = "rr", .quantum = 2,
+                             .cpu_count = 2, .queue_model = SIM_QUEUE_PER_CPU, .balance_interval = 1, .profile = &profile };
+    SimulationResult* results = run_simulation(&params);
+    assert(results != NULL);
+    int makespan = 0;
+    for (int i = 0; i < results->process_count; i++) {
+        if (results->processes[i].finish_time > makespan) makespan = results->processes[i].finish_time;
+    }
+    free_simulation_results(results);
+    assert(profile.ticks == makespan);
+    params.engine_mode = SIM_ENGINE_TICK;
+    results = run_simulation(&params);
+    free_simulation_results(results);
+    assert(profile.ticks == 2LL * makespan);
+    assert(profile.decisions > 0);
+
+#ifdef SCHED_PROFILE
+    // The tick engine steps every tick; each stepped tick runs each phase once
+    assert(profile.stepped_ticks > makespan && profile.stepped_ticks <= 2LL * makespan);
+    assert(profile.phase_count[PROFILE_PHASE_EXECUTION] == profile.stepped_ticks);
+    assert(profile.calls[PROFILE_CALL_GET_NEXT_PROCESS] >= profile.decisions && profile.decisions > 0);
+    assert(profile.calls[PROFILE_CALL_ADD_PROCESS] > 0 && profile.calls[PROFILE_CALL_NEEDS_RESCHEDULE] > 0);
+
+    // Runs without a profile leave it alone
+    EngineProfile before = profile;
+    params.profile = NULL;
+    results = run_simulation(&params);
+    free_simulation_results(results);
+    assert(memcmp(&before, &profile, sizeof(profile)) == 0);
+    printf("  ✅ Phases and policy calls are counted.\n");
+#endif
+    printf("  ✅ Profiled runs account for every tick.\n");
+}
 
 int main() {
     printf("--- Running All Scheduler Engine Tests ---\n\n");
+    register_all_policies();
     test_fifo_scheduler();
     test_lifo_scheduler();
     test_sjf_scheduler();
     test_priority_scheduler();
+    test_tied_processes_run_fcfs();
+    test_event_engine_matches_tick_engine();
+    test_workload_reuse();
+    test_multi_cpu_global_queue();
+    test_per_cpu_queues_with_stealing();
+    test_parallel_sweep();
+    test_configurable_mlfq();
+    test_streaming_source();
+    test_results_sink();
+    test_metric_reduction();
+    test_latency_percentiles();
+    test_telemetry_recorder();
+    test_event_logger();
+    test_engine_profile();
     printf("\nTEST PASSED: All Scheduler Engine tests completed.\n");
     return 0;
 }